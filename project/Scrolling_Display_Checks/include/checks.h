@@ -0,0 +1,108 @@
+/*
+ * File: checks.h
+ * Purpose: Contains Precompiler Directives, Structures
+ *          and Function Prototypes for Checking the Scrolling Display Engine
+ *          Against a Mock DAQ Module on a Simulated Clock.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef CHECKS_H
+#define CHECKS_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <string.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "scroll.h"
+#include "mock.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+#define PROGRAM_ERROR -1
+
+/****************/
+/* Enumerations */
+/****************/
+
+/* Cost of Mock DAQ Calls in Microseconds. */
+typedef enum {
+	MOCK_WRITE_MICROS = 50,
+	MOCK_READ_MICROS = 50,
+
+	/* DAQ Link Too Slow to Write a Whole Frame in DELAY_SHORT. */
+	SLOW_WRITE_MICROS = 150000
+} MOCK_COSTS;
+
+typedef enum {
+	LATENCY_SCROLLS = 3,
+
+	/* Seek Mid-Frame From Frame 4 to SEEK_FRAME. */
+	SEEK_TIME = 2200,
+	SEEK_FRAME = 30,
+
+	/* Preempt After PREEMPT_FRAME Frames; Expire Messages After EXPIRY_TIME Milliseconds. */
+	PREEMPT_FRAME = 7,
+	EXPIRY_TIME = 100,
+
+	/* Copies of the Displays Scripted at Once. */
+	MOCK_SNAPSHOTS = 4,
+
+	/* Iterations Scrolled Over a Slow DAQ Link. */
+	SLOW_SCROLLS = 1
+} CHECK_LIMITS;
+
+/**************/
+/* Structures */
+/**************/
+
+/* Switch Channel Changes to value at time Milliseconds on the Simulated Clock. */
+typedef struct {
+	unsigned long time;
+	uint8_t channel;
+	uint8_t value;
+} SWITCH_EDGE;
+
+/* Engine Runs a Scrolling Display Program Through the Mock DAQ Module Until it Finishes. */
+typedef struct {
+	const char* engine_name;
+	void (*runEngine)(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls);
+} CHECK_ENGINE;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+uint8_t checkLatency(void);
+uint8_t checkSeeking(void);
+uint8_t checkPreemption(void);
+uint8_t checkExpiry(void);
+uint8_t checkSlowLink(void);
+
+uint8_t showsFrame(const uint8_t* displays, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint16_t frame_index);
+
+void mockScript(const SWITCH_EDGE* script, uint8_t script_length);
+void mockSeek(unsigned long seek_time, uint16_t frame_index);
+void mockPost(unsigned long post_time, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, uint8_t priority);
+void mockSnapshot(unsigned long snapshot_time, uint8_t* snapshot);
+unsigned long mockElapsed(void);
+uint8_t mockActions(void);
+unsigned long mockResponse(void);
+
+void runResumeDisplay(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls);
+void runPlaylist(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls);
+void startDisplay(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls);
+
+void applyScript(void);
+void trackResponse(uint8_t data, uint8_t position);
+
+#endif
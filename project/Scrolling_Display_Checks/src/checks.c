@@ -0,0 +1,294 @@
+/*
+ * File : checks.c
+ * Purpose:	To Check the Scrolling Display Engine Against a Mock DAQ Module on a Simulated Clock.
+ * 		Input: NULL; Switch Edges Are Scripted by Each Check.
+ *		Output:	Result of Each Check.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "checks.h"
+
+/* Static Variables */
+
+/* Scripted Events Are Applied as the Mock DAQ Module Advances its Clock. */
+static const MOCK_HOOKS check_hooks = { applyScript, trackResponse, NULL };
+
+static const SWITCH_EDGE* mock_script = NULL;
+static uint8_t mock_length = FALSE;
+static uint8_t mock_next = FALSE;
+static unsigned long mock_origin = FALSE;
+
+/* Display Response to Reset Releases and Resumes From Pause. */
+static uint8_t mock_actions = FALSE;
+static uint8_t action_pending = FALSE;
+static unsigned long action_time = FALSE;
+static unsigned long worst_response = FALSE;
+
+/* Scripted Seek Arrives Like an Interrupt From a Leading Display. */
+static uint8_t seek_scripted = FALSE;
+static unsigned long seek_at = FALSE;
+static uint16_t seek_index = FALSE;
+
+/* Scripted Post Arrives Like an Interrupt Carrying a New Message. */
+static uint8_t post_scripted = FALSE;
+static unsigned long post_at = FALSE;
+static const uint8_t* post_message = NULL;
+static uint8_t post_length = FALSE;
+static uint8_t post_scrolls = FALSE;
+static uint8_t post_priority = FALSE;
+
+static uint8_t* snapshot_displays[MOCK_SNAPSHOTS];
+static unsigned long snapshot_at[MOCK_SNAPSHOTS];
+static uint8_t snapshot_count = FALSE;
+
+/*
+ * Main Function Drives the Program. Every Check Runs Even if an Earlier Check Fails.
+ * PRE: NULL (no pre-conditions)
+ * POST: result of each check printed to stdout.
+ * RETURN: 0 if every check passed; otherwise PROGRAM_ERROR.
+ */
+int main(void) {
+	uint8_t checks_passed = TRUE;
+
+	clearMock();
+	mockCosts(MOCK_WRITE_MICROS, MOCK_READ_MICROS);
+	mockHooks(&check_hooks);
+
+	/* Pace Frames to the Mock DAQ Module Like the Scrolling Display Program. */
+	calibrateDAQ(DELAY_SHORT);
+
+	if (checkLatency() == FALSE) checks_passed = FALSE;
+	if (checkSeeking() == FALSE) checks_passed = FALSE;
+	if (checkPreemption() == FALSE) checks_passed = FALSE;
+	if (checkExpiry() == FALSE) checks_passed = FALSE;
+	if (checkSlowLink() == FALSE) checks_passed = FALSE;
+
+	fprintf(stdout, "\n%s\n", (checks_passed == TRUE) ? "All Checks Passed." : "Checks Failed.");
+
+	return (checks_passed == TRUE) ? FALSE : PROGRAM_ERROR;
+}
+
+/*
+ * Scripts Switch Edges Relative to the Current Time on the Simulated Clock.
+ *
+ * PARAM: script is a pointer to an array of SWITCH_EDGEs in order of time;
+ *		  script_length is a uint8_t which represents the number of edges in the script.
+ * PRE: NULL (no pre-conditions)
+ * POST: switches are in run with no reset; display responses are cleared.
+ * RETURN: VOID
+ */
+void mockScript(const SWITCH_EDGE* script, uint8_t script_length) {
+	mock_script = script;
+	mock_length = script_length;
+	mock_next = FALSE;
+	mock_origin = mockMicros();
+
+	mockSwitch(RESET_CHANNEL, FALSE);
+	mockSwitch(RUN_CHANNEL, TRUE);
+
+	mock_actions = FALSE;
+	action_pending = FALSE;
+	worst_response = FALSE;
+
+	seek_scripted = FALSE;
+	post_scripted = FALSE;
+	snapshot_count = FALSE;
+}
+
+/*
+ * Scripts a Call to seekDisplay Relative to the Start of the Script.
+ *
+ * PARAM: seek_time is an unsigned long representing the time of the seek in milliseconds;
+ *		  frame_index is a uint16_t representing the frame to seek to.
+ * PRE: mockScript has been called.
+ * POST: seekDisplay(frame_index) is called once the simulated clock reaches seek_time.
+ * RETURN: VOID
+ */
+void mockSeek(unsigned long seek_time, uint16_t frame_index) {
+	seek_scripted = TRUE;
+	seek_at = mock_origin + seek_time * 1000;
+	seek_index = frame_index;
+}
+
+/*
+ * Scripts a Call to postMessage Relative to the Start of the Script.
+ *
+ * PARAM: post_time is an unsigned long representing the time of the post in milliseconds;
+ *		  message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations;
+ * 		  priority is a uint8_t where larger values are scrolled first.
+ * PRE: mockScript has been called.
+ * POST: message is posted to play once when the simulated clock reaches post_time.
+ * RETURN: VOID
+ */
+void mockPost(unsigned long post_time, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, uint8_t priority) {
+	post_scripted = TRUE;
+	post_at = mock_origin + post_time * 1000;
+
+	post_message = message;
+	post_length = message_length;
+	post_scrolls = number_scrolls;
+	post_priority = priority;
+}
+
+/*
+ * Scripts a Copy of the Mock Digital Displays Relative to the Start of the Script.
+ * Up to MOCK_SNAPSHOTS Copies Can Be Scripted at Once.
+ *
+ * PARAM: snapshot_time is an unsigned long representing the time of the copy in milliseconds;
+ *		  snapshot is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes receiving the copy.
+ * PRE: mockScript has been called.
+ * POST: snapshot holds the digital displays once the simulated clock reaches snapshot_time.
+ * RETURN: VOID
+ */
+void mockSnapshot(unsigned long snapshot_time, uint8_t* snapshot) {
+	if (snapshot_count >= MOCK_SNAPSHOTS) return;
+
+	snapshot_displays[snapshot_count] = snapshot;
+	snapshot_at[snapshot_count++] = mock_origin + snapshot_time * 1000;
+}
+
+/*
+ * Measures the Time Since the Start of the Script.
+ *
+ * PARAM: VOID
+ * PRE: mockScript has been called.
+ * POST: NULL (no side-effects)
+ * RETURN: milliseconds elapsed on the simulated clock.
+ */
+unsigned long mockElapsed(void) {
+	return (mockMicros() - mock_origin) / 1000;
+}
+
+/*
+ * Counts the Reset Releases and Resumes From Pause Since the Script Started.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: number of scripted switch actions which have taken place.
+ */
+uint8_t mockActions(void) {
+	return mock_actions;
+}
+
+/*
+ * Finds the Slowest Display Response to a Scripted Switch Action.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: milliseconds from a switch action to the next change of a digital display, at worst.
+ */
+unsigned long mockResponse(void) {
+	return worst_response;
+}
+
+/*
+ * Runs resumeDisplay From the First Frame Through the Mock DAQ Module Until it Finishes.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations.
+ * PRE: NULL (no pre-conditions)
+ * POST: digital displays are all turned on.
+ * RETURN: VOID
+ */
+void runResumeDisplay(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls) {
+	runMock(startDisplay, message, message_length, number_scrolls);
+}
+
+/*
+ * Runs resumeDisplay From the First Frame as a Mock Engine.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations.
+ * PRE: called by runMock.
+ * POST: digital displays are all turned on.
+ * RETURN: VOID
+ */
+void startDisplay(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls) {
+	resumeDisplay(message, message_length, number_scrolls, VALUE_MIN);
+}
+
+/*
+ * Runs playPlaylist With a Single Queued Message Through the Mock DAQ Module Until it Finishes.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations.
+ * PRE: NULL (no pre-conditions)
+ * POST: digital displays are all turned on; playlist is empty.
+ * RETURN: VOID
+ */
+void runPlaylist(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls) {
+	if (queueMessage(message, message_length, number_scrolls, PRIORITY_NORMAL, 1, NEVER_EXPIRES) == FALSE) return;
+
+	playPlaylist();
+}
+
+/*
+ * Applies Every Scripted Switch Edge Reached by the Simulated Clock.
+ *
+ * PARAM: VOID
+ * PRE: called by the mock DAQ module whenever its clock advances.
+ * POST: switches hold the value of their last scripted edge; scripted seeks, posts and snapshots are taken.
+ * RETURN: VOID
+ */
+void applyScript(void) {
+	const SWITCH_EDGE* next_edge = NULL;
+	unsigned long current_micros = mockMicros();
+	uint8_t snapshot_index = FALSE;
+
+	while (mock_next < mock_length && mock_origin + mock_script[mock_next].time * 1000 <= current_micros) {
+		next_edge = &mock_script[mock_next++];
+		mockSwitch(next_edge->channel, next_edge->value);
+
+		/* Reset Takes Effect on Release; Pause Ends When Run is Restored. */
+		if ((next_edge->channel == RESET_CHANNEL && next_edge->value == FALSE) ||
+			(next_edge->channel == RUN_CHANNEL && next_edge->value == TRUE)) {
+			mock_actions++;
+			action_pending = TRUE;
+			action_time = mock_origin + next_edge->time * 1000;
+		}
+	}
+
+	if (seek_scripted == TRUE && seek_at <= current_micros) {
+		seek_scripted = FALSE;
+		seekDisplay(seek_index);
+	}
+
+	if (post_scripted == TRUE && post_at <= current_micros) {
+		post_scripted = FALSE;
+		postMessage(post_message, post_length, post_scrolls, post_priority, 1, NEVER_EXPIRES);
+	}
+
+	for (snapshot_index = 0; snapshot_index < snapshot_count; snapshot_index++) {
+		if (snapshot_displays[snapshot_index] == NULL || snapshot_at[snapshot_index] > current_micros) continue;
+
+		memcpy(snapshot_displays[snapshot_index], mockDisplays(), NUMBER_DISPLAYS);
+		snapshot_displays[snapshot_index] = NULL;
+	}
+}
+
+/*
+ * Times the First Change of a Digital Display After a Scripted Switch Action.
+ *
+ * PARAM: data is a uint8_t representing the byte about to be written;
+ *		  position is a uint8_t representing the digital display being written.
+ * PRE: called by the mock DAQ module before the digital display is written.
+ * POST: slowest display response is updated.
+ * RETURN: VOID
+ */
+void trackResponse(uint8_t data, uint8_t position) {
+	unsigned long response = FALSE;
+
+	if (action_pending == FALSE || mockDisplays()[position] == data) return;
+
+	response = (mockMicros() - action_time) / 1000;
+	if (response > worst_response) worst_response = response;
+	action_pending = FALSE;
+}
@@ -0,0 +1,75 @@
+/*
+ * File : latency.c
+ * Purpose:	To Check Switch Latency of the Scrolling Display Engine Stays Within LATENCY_TARGET.
+ * 		Input: Reset and Pause Edges Scripted Mid-Frame on the Simulated Clock.
+ *		Output:	Switch Latency Percentiles and the Slowest Display Response of Each Engine.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "checks.h"
+
+/* Static Variables */
+
+/* Edges Fall Mid-Frame, Where Waiting Out the Frame Would Miss the Target. */
+static const SWITCH_EDGE latency_script[] = {
+	/* Reset. */
+	{ 1230, RESET_CHANNEL, TRUE },
+	{ 1310, RESET_CHANNEL, FALSE },
+
+	/* Pause. */
+	{ 4120, RUN_CHANNEL, FALSE },
+	{ 5075, RUN_CHANNEL, TRUE },
+
+	/* Reset. */
+	{ 7777, RESET_CHANNEL, TRUE },
+	{ 7840, RESET_CHANNEL, FALSE },
+
+	/* Pause. */
+	{ 9333, RUN_CHANNEL, FALSE },
+	{ 9990, RUN_CHANNEL, TRUE }
+};
+
+static const uint8_t latency_length = sizeof(latency_script) / sizeof(latency_script[0]);
+
+static const CHECK_ENGINE latency_engines[] = {
+	{ "playPlaylist", runPlaylist },
+	{ "resumeDisplay", runResumeDisplay }
+};
+
+static const uint8_t engine_count = sizeof(latency_engines) / sizeof(latency_engines[0]);
+
+/*
+ * Runs Each Engine Through the Latency Script. An Engine Fails if a Switch Action Goes Unrecorded,
+ * if the 99th Percentile Recorded Latency Exceeds LATENCY_TARGET, or if the Digital Displays
+ * Take Longer Than LATENCY_TARGET to Respond to Any Switch Action.
+ *
+ * PARAM: VOID
+ * PRE: DAQ module has been calibrated.
+ * POST: latencies of each engine printed to stdout.
+ * RETURN: TRUE if every engine met the latency target; otherwise FALSE.
+ */
+uint8_t checkLatency(void) {
+	uint8_t engines_passed = TRUE;
+	uint8_t engine_index = FALSE;
+	uint8_t start_samples = FALSE;
+	uint8_t new_samples = FALSE;
+
+	for (engine_index = 0; engine_index < engine_count; engine_index++) {
+		start_samples = switchSamples();
+
+		mockScript(latency_script, latency_length);
+		latency_engines[engine_index].runEngine(phrase_message, PHRASE_LENGTH, LATENCY_SCROLLS);
+
+		new_samples = switchSamples() - start_samples;
+
+		fprintf(stdout, "%-16s Switch Actions = %u, Samples = %u, p50 = %lu ms, p99 = %lu ms, Slowest Response = %lu ms\n",
+			latency_engines[engine_index].engine_name, (unsigned)mockActions(), (unsigned)new_samples,
+			switchLatency(50), switchLatency(99), mockResponse());
+
+		if (mockActions() != latency_length / 2 || new_samples != mockActions() ||
+			switchLatency(99) > LATENCY_TARGET || mockResponse() > LATENCY_TARGET) engines_passed = FALSE;
+	}
+
+	return engines_passed;
+}
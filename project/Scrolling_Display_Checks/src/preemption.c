@@ -0,0 +1,119 @@
+/*
+ * File : preemption.c
+ * Purpose:	To Check the Playlist Preempts Messages at Frame Boundaries and Removes Expired Messages.
+ * 		Input: Messages Posted Mid-Frame on the Simulated Clock While playPlaylist Runs.
+ *		Output:	Result of Preemption, Resumption and Expiry.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "checks.h"
+
+/*
+ * Posts the Ending Message Part Way Through Frame PREEMPT_FRAME - 1 of the Phrase Message.
+ * The Check Fails Unless the Ending Message Takes Over at the Next Frame Boundary and the
+ * Phrase Message Then Resumes at Frame PREEMPT_FRAME and Plays to its Last Frame.
+ *
+ * PARAM: VOID
+ * PRE: playlist is empty; DAQ module has been calibrated.
+ * POST: result of the preemption printed to stdout; playlist is empty.
+ * RETURN: TRUE if the playlist preempted and resumed the phrase message; otherwise FALSE.
+ */
+uint8_t checkPreemption(void) {
+	/* Local Variables */
+
+	uint8_t preempt_displays[NUMBER_DISPLAYS];
+	uint8_t resume_displays[NUMBER_DISPLAYS];
+
+	uint16_t phrase_frames = countFrames(PHRASE_LENGTH, LATENCY_SCROLLS);
+	uint16_t ending_frames = countFrames(ENDING_LENGTH, VALUE_MIN);
+
+	/* Every Frame of Both Messages, Each Followed by a Wait. */
+	unsigned long expected_time = (unsigned long)(phrase_frames + ending_frames) * DELAY_SHORT;
+	unsigned long elapsed_time = FALSE;
+
+	uint8_t preempted = FALSE;
+	uint8_t resumed = FALSE;
+
+	memset(preempt_displays, DISPLAY_OFF, NUMBER_DISPLAYS);
+	memset(resume_displays, DISPLAY_OFF, NUMBER_DISPLAYS);
+
+	mockScript(NULL, FALSE);
+	mockPost((unsigned long)PREEMPT_FRAME * DELAY_SHORT - DELAY_SHORT / 2, ending_message, ENDING_LENGTH, VALUE_MIN, PRIORITY_HIGH);
+	mockSnapshot((unsigned long)PREEMPT_FRAME * DELAY_SHORT + DELAY_SHORT / 2, preempt_displays);
+	mockSnapshot((unsigned long)(PREEMPT_FRAME + ending_frames) * DELAY_SHORT + DELAY_SHORT / 2, resume_displays);
+
+	runPlaylist(phrase_message, PHRASE_LENGTH, LATENCY_SCROLLS);
+	elapsed_time = mockElapsed();
+
+	/* Higher Priority Takes Over at the Next Frame Boundary. */
+	preempted = showsFrame(preempt_displays, ending_message, ENDING_LENGTH, VALUE_MIN, VALUE_MIN);
+	resumed = showsFrame(resume_displays, phrase_message, PHRASE_LENGTH, LATENCY_SCROLLS, PREEMPT_FRAME) &&
+		elapsed_time >= expected_time && elapsed_time < expected_time + DELAY_SHORT / 2 && playlistLength() == FALSE;
+
+	fprintf(stdout, "%-16s Preempted at Frame %u : %s, Resumed at Frame %u : %s, Elapsed = %lu ms (Expected %lu ms)\n", "postMessage",
+		(unsigned)PREEMPT_FRAME, preempted ? "Yes" : "No", (unsigned)PREEMPT_FRAME, resumed ? "Yes" : "No", elapsed_time, expected_time);
+
+	return preempted && resumed;
+}
+
+/*
+ * Fills the Playlist Behind the Phrase Message With Messages Which Expire, Then Posts a
+ * Higher Priority Message After They Expire. The Check Fails if a Full Playlist Accepts
+ * a Message Before They Expire, or if the Posted Message Waits for the Phrase Message to End.
+ *
+ * PARAM: VOID
+ * PRE: playlist is empty; DAQ module has been calibrated.
+ * POST: result of the expiry printed to stdout; playlist is empty.
+ * RETURN: TRUE if expired messages made room in the full playlist; otherwise FALSE.
+ */
+uint8_t checkExpiry(void) {
+	uint8_t expiry_displays[NUMBER_DISPLAYS];
+	unsigned long expiry_time = FALSE;
+
+	uint8_t refused = FALSE;
+	uint8_t accepted = FALSE;
+
+	memset(expiry_displays, DISPLAY_OFF, NUMBER_DISPLAYS);
+
+	mockScript(NULL, FALSE);
+	expiry_time = millis() + EXPIRY_TIME;
+
+	/* Expired Messages Never Reach the Front Behind a Message of Higher Priority. */
+	while (queueMessage(ending_message, ENDING_LENGTH, VALUE_MIN, PRIORITY_LOW, 1, expiry_time) == TRUE);
+	refused = (playlistLength() == PLAYLIST_CAPACITY);
+	removeFirst();
+
+	mockPost(2 * EXPIRY_TIME, ending_message, ENDING_LENGTH, VALUE_MIN, PRIORITY_HIGH);
+	mockSnapshot(DELAY_SHORT + DELAY_SHORT / 2, expiry_displays);
+
+	/* Phrase Message Fills the Playlist Again. */
+	runPlaylist(phrase_message, PHRASE_LENGTH, LATENCY_SCROLLS);
+
+	accepted = showsFrame(expiry_displays, ending_message, ENDING_LENGTH, VALUE_MIN, VALUE_MIN) && playlistLength() == FALSE;
+
+	fprintf(stdout, "%-16s Full Playlist Refused Messages : %s, Expired Messages Made Room : %s\n", "postMessage",
+		refused ? "Yes" : "No", accepted ? "Yes" : "No");
+
+	return refused && accepted;
+}
+
+/*
+ * Compares a Copy of the Digital Displays Against a Frame Computed From its Index.
+ *
+ * PARAM: displays is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes;
+ *		  message is a uint8_t pointer to the array of bytes of the expected message;
+ * 		  message_length and number_scrolls are uint8_ts describing the message;
+ * 		  frame_index is a uint16_t representing the expected frame.
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: TRUE if the displays hold the frame; otherwise FALSE.
+ */
+uint8_t showsFrame(const uint8_t* displays, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint16_t frame_index) {
+	uint8_t expected_frame[NUMBER_DISPLAYS];
+
+	computeFrame(message, message_length, number_scrolls, frame_index, expected_frame);
+
+	return memcmp(displays, expected_frame, NUMBER_DISPLAYS) == FALSE;
+}
@@ -0,0 +1,51 @@
+/*
+ * File : seeking.c
+ * Purpose:	To Check a Running Scrolling Display Follows seekDisplay at its Next Frame Boundary.
+ * 		Input: Seek Scripted Mid-Frame on the Simulated Clock.
+ *		Output:	Frame Written After the Seek and the Length of the Scrolling Display.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "checks.h"
+
+/*
+ * Seeks resumeDisplay Forward in the Middle of a Frame. The Check Fails if the Next Frame
+ * is Not SEEK_FRAME or if the Frames Skipped by the Seek Are Still Written.
+ *
+ * PARAM: VOID
+ * PRE: DAQ module has been calibrated.
+ * POST: result of the seek printed to stdout.
+ * RETURN: TRUE if the running scrolling display followed the seek; otherwise FALSE.
+ */
+uint8_t checkSeeking(void) {
+	/* Local Variables */
+
+	uint8_t seek_displays[NUMBER_DISPLAYS];
+	uint8_t expected_displays[NUMBER_DISPLAYS];
+
+	uint16_t total_frames = countFrames(PHRASE_LENGTH, LATENCY_SCROLLS);
+	uint16_t seek_start = SEEK_TIME / DELAY_SHORT + 1;
+
+	/* Frames Before the Seek, Then SEEK_FRAME Onwards; the Last Frame Has No Wait. */
+	unsigned long expected_time = (unsigned long)(seek_start + total_frames - SEEK_FRAME - 1) * DELAY_SHORT;
+	unsigned long elapsed_time = FALSE;
+
+	memset(seek_displays, DISPLAY_OFF, NUMBER_DISPLAYS);
+	computeFrame(phrase_message, PHRASE_LENGTH, LATENCY_SCROLLS, SEEK_FRAME, expected_displays);
+
+	mockScript(NULL, FALSE);
+	mockSeek(SEEK_TIME, SEEK_FRAME);
+	mockSnapshot((unsigned long)seek_start * DELAY_SHORT + DELAY_SHORT / 2, seek_displays);
+
+	runResumeDisplay(phrase_message, PHRASE_LENGTH, LATENCY_SCROLLS);
+	elapsed_time = mockElapsed();
+
+	fprintf(stdout, "%-16s Seek to Frame %u : %s, Elapsed = %lu ms (Expected %lu ms)\n", "seekDisplay", (unsigned)SEEK_FRAME,
+		(memcmp(seek_displays, expected_displays, NUMBER_DISPLAYS) == FALSE) ? "Followed" : "Not Followed",
+		elapsed_time, expected_time);
+
+	/* Elapsed Time Allows for the Cost of Mock DAQ Calls. */
+	return memcmp(seek_displays, expected_displays, NUMBER_DISPLAYS) == FALSE &&
+		elapsed_time >= expected_time && elapsed_time < expected_time + DELAY_SHORT / 2;
+}
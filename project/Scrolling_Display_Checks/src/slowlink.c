@@ -0,0 +1,74 @@
+/*
+ * File : slowlink.c
+ * Purpose:	To Check Slow DAQ Links Skip Frames to Hold the Scroll Speed Instead of Slowing the Scroll.
+ * 		Input: displayWrite Calls Costing SLOW_WRITE_MICROS on the Simulated Clock.
+ *		Output:	Calibrated Pacing, Length of Each Scrolling Display and Whether its Final Frame Was Written in Full.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "checks.h"
+
+/* Static Variables */
+
+static const CHECK_ENGINE slow_engines[] = {
+	{ "playPlaylist", runPlaylist },
+	{ "resumeDisplay", runResumeDisplay }
+};
+
+static const uint8_t engine_count = sizeof(slow_engines) / sizeof(slow_engines[0]);
+
+/*
+ * Calibrates Against a Slow DAQ Link and Scrolls the Phrase Message Through Each Engine.
+ * An Engine Fails if the Frame Length Changes From DELAY_SHORT, if the Scrolling Display
+ * Runs Longer Than its Frames Take at DELAY_SHORT, or if its Final Frame is Not Written in Full.
+ *
+ * PARAM: VOID
+ * PRE: playlist is empty.
+ * POST: result of the check printed to stdout; DAQ module is calibrated to the usual mock costs.
+ * RETURN: TRUE if every engine held the scroll speed and wrote its final frame; otherwise FALSE.
+ */
+uint8_t checkSlowLink(void) {
+	/* Local Variables */
+
+	uint8_t final_displays[NUMBER_DISPLAYS];
+
+	uint16_t total_frames = countFrames(PHRASE_LENGTH, SLOW_SCROLLS);
+
+	/* Every Frame Takes DELAY_SHORT; the Final Frame May Overrun by a Whole Frame of Writes. */
+	unsigned long expected_time = (unsigned long)total_frames * DELAY_SHORT;
+	unsigned long elapsed_time = FALSE;
+
+	uint8_t engines_passed = TRUE;
+	uint8_t engine_index = FALSE;
+	uint8_t final_written = FALSE;
+
+	mockCosts(SLOW_WRITE_MICROS, MOCK_READ_MICROS);
+	calibrateDAQ(DELAY_SHORT);
+
+	computeFrame(phrase_message, PHRASE_LENGTH, SLOW_SCROLLS, total_frames - 1, final_displays);
+
+	fprintf(stdout, "%-16s Frame Length = %lu ms (Expected %d ms), Frame Writes = %u\n", "calibrateDAQ",
+		daq_pacing.frame_length, DELAY_SHORT, (unsigned)daq_pacing.frame_writes);
+
+	if (daq_pacing.frame_length != DELAY_SHORT) engines_passed = FALSE;
+
+	for (engine_index = 0; engine_index < engine_count; engine_index++) {
+		mockScript(NULL, FALSE);
+		slow_engines[engine_index].runEngine(phrase_message, PHRASE_LENGTH, SLOW_SCROLLS);
+
+		elapsed_time = mockElapsed();
+		final_written = memcmp(mockDisplays(), final_displays, NUMBER_DISPLAYS) == FALSE;
+
+		fprintf(stdout, "%-16s Elapsed = %lu ms (Expected %lu ms), Final Frame Written : %s\n", slow_engines[engine_index].engine_name,
+			elapsed_time, expected_time, final_written ? "Yes" : "No");
+
+		if (final_written == FALSE || elapsed_time + DELAY_SHORT < expected_time ||
+			elapsed_time > expected_time + (NUMBER_DISPLAYS * SLOW_WRITE_MICROS) / 1000) engines_passed = FALSE;
+	}
+
+	mockCosts(MOCK_WRITE_MICROS, MOCK_READ_MICROS);
+	calibrateDAQ(DELAY_SHORT);
+
+	return engines_passed;
+}
@@ -0,0 +1,150 @@
+/*
+ * File : board.c
+ * Purpose:	To Stand In for the Board Support Package When Linking the Freestanding Image.
+ * 		Input: NULL; DAQ Library Functions Drive Memory Instead of Peripherals.
+ *		Output:	Linked Image Whose Size Matches a Board With Equivalent Drivers.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include <stddef.h>
+
+#include "scroll.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+#ifndef FIRMWARE_STACK
+#define FIRMWARE_STACK 1024
+#endif
+
+/* Cortex-M0 Vector Table Entries Up to SysTick. */
+#define VECTOR_ENTRIES 16
+#define SYSTICK_VECTOR 15
+
+/* Static Variables */
+
+static uint32_t firmware_stack[FIRMWARE_STACK / sizeof(uint32_t)];
+
+/* Stand-Ins for Peripheral Registers. */
+static volatile unsigned long board_ticks;
+static volatile uint8_t board_displays[NUMBER_DISPLAYS];
+static volatile uint8_t board_switches[2] = { FALSE, TRUE };
+
+int main(void);
+
+void Reset_Handler(void);
+void SysTick_Handler(void);
+
+/* Linked as the Entry Point, so --gc-sections Keeps it. */
+__attribute__((section(".isr_vector"), used))
+void (* const vector_table[VECTOR_ENTRIES])(void) = {
+	(void (*)(void))(firmware_stack + FIRMWARE_STACK / sizeof(uint32_t)),
+	Reset_Handler,
+
+	[SYSTICK_VECTOR] = SysTick_Handler
+};
+
+/*
+ * Starts the Firmware. A Board's Startup Code Also Copies .data and Clears .bss Here.
+ *
+ * PARAM: VOID
+ * PRE: processor has come out of reset.
+ * POST: NULL (no side-effects)
+ * RETURN: never returns.
+ */
+void Reset_Handler(void) {
+	main();
+
+	while (TRUE);
+}
+
+/*
+ * Counts Milliseconds for millis() and delay().
+ *
+ * PARAM: VOID
+ * PRE: SysTick is configured for a 1 ms period.
+ * POST: board_ticks has advanced by one millisecond.
+ * RETURN: VOID
+ */
+void SysTick_Handler(void) {
+	board_ticks++;
+}
+
+/**************************************************************/
+/* Stub DAQ Module: the Board Support Package Replaces These. */
+/**************************************************************/
+
+int setupDAQ(int setupNum) {
+	return TRUE;
+}
+
+int digitalRead(int channel) {
+	return (channel == RESET_CHANNEL || channel == RUN_CHANNEL) ? board_switches[channel] : FALSE;
+}
+
+double analogRead(int channel) {
+	return 0.0;
+}
+
+void digitalWrite(int channel, int val) {
+	return;
+}
+
+void displayWrite(int data, int position) {
+	if (position >= VALUE_MIN && position < NUMBER_DISPLAYS) board_displays[position] = (uint8_t)data;
+}
+
+int continueSuperLoop(void) {
+	return TRUE;
+}
+
+void delay(unsigned long ms) {
+	unsigned long start_time = board_ticks;
+
+	while (board_ticks - start_time < ms);
+}
+
+unsigned long millis(void) {
+	return board_ticks;
+}
+
+/******************************************************************************/
+/* GCC Requires These of Freestanding Targets for Structure and Array Copies. */
+/******************************************************************************/
+
+void* memcpy(void* destination, const void* source, size_t length) {
+	uint8_t* write_byte = destination;
+	const uint8_t* read_byte = source;
+
+	while (length-- > 0) *write_byte++ = *read_byte++;
+	return destination;
+}
+
+void* memmove(void* destination, const void* source, size_t length) {
+	uint8_t* write_byte = destination;
+	const uint8_t* read_byte = source;
+
+	if (write_byte < read_byte) return memcpy(destination, source, length);
+
+	while (length-- > 0) write_byte[length] = read_byte[length];
+	return destination;
+}
+
+void* memset(void* destination, int value, size_t length) {
+	uint8_t* write_byte = destination;
+
+	while (length-- > 0) *write_byte++ = (uint8_t)value;
+	return destination;
+}
+
+int memcmp(const void* first, const void* second, size_t length) {
+	const uint8_t* first_byte = first;
+	const uint8_t* second_byte = second;
+
+	for (; length > 0; length--, first_byte++, second_byte++)
+		if (*first_byte != *second_byte) return *first_byte - *second_byte;
+
+	return FALSE;
+}
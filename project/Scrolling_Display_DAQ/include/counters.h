@@ -58,6 +58,13 @@ typedef enum {
     DELAY_SHORT = 500
 } DELAY_LENGTHS;
 
+/**********************/
+/**** Font Tables ****/
+/*********************/
+
+/* Encodings of DISPLAY_0 ... DISPLAY_9 Indexed by Digit. */
+extern const uint8_t digit_encodings[];
+
 /***********************/
 /* Function Prototypes */
 /***********************/
@@ -0,0 +1,53 @@
+/*
+ * File: frames.h
+ * Purpose: Contains Precompiler Directives, Enumerations
+ *          and Function Prototypes for Random Access to
+ *          Scrolling Display Frames.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef FRAMES_H
+#define FRAMES_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <stdint.h>
+
+#include "counters.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+#define FALSE 0
+#define TRUE 1
+
+/****************/
+/* Enumerations */
+/****************/
+
+/* Frames Per Scrolling Display Iteration (Complete and Separated Message). */
+typedef enum {
+	ITERATION_FRAMES = NUMBER_DISPLAYS,
+	DOUBLE_ITERATION_FRAMES = NUMBER_DISPLAYS + 1
+} FRAME_LENGTHS;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+uint16_t countFrames(uint8_t message_length, uint8_t number_scrolls);
+uint8_t computeFrame(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, uint16_t frame_index, uint8_t* frame);
+
+void startingFrame(const uint8_t* message, uint8_t message_length, uint8_t frame_step, uint8_t* frame);
+void completeFrame(const uint8_t* message, uint8_t message_length, uint8_t counter, uint8_t frame_step, uint8_t* frame);
+void separatedFrame(const uint8_t* message, uint8_t message_length, uint8_t counter, uint8_t frame_step, uint8_t* frame);
+void finishingFrame(const uint8_t* message, uint8_t message_length, uint8_t counter, uint8_t frame_step, uint8_t* frame);
+
+void frameCounter(uint8_t counter, int8_t starting_position, uint8_t* frame);
+void frameWrite(uint8_t data, int8_t display_position, uint8_t* frame);
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * File: pacing.h
+ * Purpose: Contains Precompiler Directives, Structures
+ *          and Function Prototypes for Calibrating DAQ Latency
+ *          and Pacing the Scrolling Display Frames.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef PACING_H
+#define PACING_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <stdint.h>
+
+/* Provided by UBC ECE Department. */
+#include "DAQlib.h"
+
+#include "switches.h"
+#include "counters.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+#define FALSE 0
+#define TRUE 1
+
+/****************/
+/* Enumerations */
+/****************/
+
+typedef enum {
+	/* DAQ Calls Timed per Measurement. */
+	CALIBRATION_CALLS = 100,
+
+	/* Frame Writes Are Budgeted at Most 1 / FRAME_WRITE_SHARE of the Frame. */
+	FRAME_WRITE_SHARE = 2,
+
+	/* Switch Polling Uses at Most 1 / POLL_DUTY_SHARE of the Time Between Polls. */
+	POLL_DUTY_SHARE = 4
+} PACING_RATIOS;
+
+/**************/
+/* Structures */
+/**************/
+
+/* Measured DAQ Costs and the Pacing Derived From Them. */
+typedef struct {
+	unsigned long write_micros;
+	unsigned long read_micros;
+
+	unsigned long poll_interval;
+	unsigned long frame_length;
+
+	/* Changed Displays Written Within the Write Budget of a Frame. */
+	uint8_t frame_writes;
+} DAQ_PACING;
+
+/***************************/
+/**** Static Variables ****/
+/***************************/
+
+extern DAQ_PACING daq_pacing;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+void calibrateDAQ(unsigned long frame_length);
+
+unsigned long timeWrites(void);
+unsigned long timeReads(void);
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * File: playlist.h
+ * Purpose: Contains Precompiler Directives, Structures
+ *          and Function Prototypes for the Priority Message Playlist.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef PLAYLIST_H
+#define PLAYLIST_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "counters.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+#define FALSE 0
+#define TRUE 1
+
+/* Maximum Number of Queued Messages. */
+#ifndef PLAYLIST_CAPACITY
+#define PLAYLIST_CAPACITY 1024
+#endif
+
+/* Maximum Number of Posted Messages Waiting for the Next Frame Boundary. */
+#ifndef PLAYLIST_POSTS
+#define PLAYLIST_POSTS 8
+#endif
+
+/* Repeat Count and Expiry Time Which Never Run Out. */
+#define REPEAT_FOREVER 0
+#define NEVER_EXPIRES 0
+
+/****************/
+/* Enumerations */
+/****************/
+
+/* Larger Priorities Are Scrolled First. */
+typedef enum {
+	PRIORITY_LOW = 0,
+	PRIORITY_NORMAL = 1,
+	PRIORITY_HIGH = 2
+} PLAYLIST_PRIORITIES;
+
+/**************/
+/* Structures */
+/**************/
+
+/* Queued Message; Keeps its Frame Index While Preempted by Higher Priorities. */
+typedef struct {
+	const uint8_t* message;
+	uint8_t message_length;
+	uint8_t number_scrolls;
+
+	uint8_t priority;
+	uint8_t repeat_count;
+	unsigned long expiry_time;
+
+	uint16_t frame_index;
+	uint16_t total_frames;
+
+	/* Messages of Equal Priority Play in the Order They Were Queued. */
+	unsigned long queue_order;
+} PLAYLIST_ITEM;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+uint8_t queueMessage(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint8_t priority, uint8_t repeat_count, unsigned long expiry_time);
+uint8_t postMessage(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint8_t priority, uint8_t repeat_count, unsigned long expiry_time);
+uint16_t playlistLength(void);
+
+uint8_t playlistFrame(uint8_t* frame);
+void playPlaylist(void);
+void skipFrames(uint16_t frame_count);
+
+void fillItem(PLAYLIST_ITEM* item, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint8_t priority, uint8_t repeat_count, unsigned long expiry_time);
+uint8_t insertItem(const PLAYLIST_ITEM* item);
+void insertPosts(void);
+
+uint8_t playsBefore(const PLAYLIST_ITEM* item, const PLAYLIST_ITEM* other);
+void siftUp(uint16_t item_index);
+void siftDown(uint16_t item_index);
+void removeFirst(void);
+void removeExpired(unsigned long current_time);
+
+#endif
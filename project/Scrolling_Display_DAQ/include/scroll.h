@@ -0,0 +1,86 @@
+/*
+ * File: scroll.h
+ * Purpose: Contains Constants, Function Prototypes, and Message Arrays
+ *          for the Scrolling Display. Depends Only on the DAQ Library,
+ *          so it Can Be Built Freestanding for Microcontroller Targets.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef SCROLL_H
+#define SCROLL_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <stdint.h>
+
+#include "switches.h"
+#include "counters.h"
+#include "frames.h"
+#include "playlist.h"
+#include "pacing.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+/* Active High Signals used to Turn On 8-Segment Displays. */
+#define DISPLAY_H 0b01101110
+#define DISPLAY_E 0b10011110
+#define DISPLAY_L 0b00011100
+#define DISPLAY_O 0b11111100
+
+#define DISPLAY_b 0b00111110
+#define DISPLAY_y 0b01110110
+#define DISPLAY_e 0b11011110
+
+/****************/
+/* Enumerations */
+/****************/
+
+typedef enum {
+	PHRASE_LENGTH = 5,
+	ENDING_LENGTH = 6,
+
+	MIN_COUNTER_LENGTH = 2,
+	MAX_COUNTER_LENGTH = 3,
+
+	LEADING_COUNTER_OFFSET = 2
+} MESSAGE_LENGTHS;
+
+/***************************/
+/**** Static Variables ****/
+/***************************/
+
+/* Message Arrays Are Read-Only Data According to DAQ Definitions. */
+extern const uint8_t phrase_message[];
+extern const uint8_t ending_message[];
+
+extern uint8_t display_scrolls;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+void scrollDisplay(const uint8_t* message, uint8_t message_length, int8_t number_scrolls);
+void endDisplay(const uint8_t* message, uint8_t message_length, uint8_t counter);
+
+void resumeDisplay(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, uint16_t frame_index);
+void seekDisplay(uint16_t frame_index);
+uint16_t displayFrame(void);
+void writeFrame(const uint8_t* frame, uint8_t write_all);
+
+void shiftStartingMessage(const uint8_t* message, uint8_t message_length);
+void shiftFinishingMessage(const uint8_t* message, uint8_t message_length, uint8_t counter);
+
+void shiftCompleteMessage(const uint8_t* message, uint8_t message_length, uint8_t counter);
+void shiftSeparatedMessage(const uint8_t* message, uint8_t message_length, uint8_t counter);
+
+void refreshDisplay(uint8_t refresh_start, uint8_t refresh_end, uint8_t turn_on);
+
+/* Provided by the Program Driving the Scrolling Display. */
+void finishDisplay(void);
+
+#endif
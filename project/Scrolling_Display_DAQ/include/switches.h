@@ -25,6 +25,11 @@
 #define FALSE 0
 #define TRUE 1
 
+/* Number of Switch Latency Samples Kept for Percentile Reports. */
+#ifndef LATENCY_SAMPLES
+#define LATENCY_SAMPLES 64
+#endif
+
 /****************/
 /* Enumerations */
 /****************/
@@ -34,6 +39,12 @@ typedef enum {
     RUN_CHANNEL = 1
 } SWITCH_CHANNELS;
 
+/* Switch Timings in Milliseconds. */
+typedef enum {
+    POLL_INTERVAL = 1,
+    LATENCY_TARGET = 10
+} SWITCH_TIMINGS;
+
 /***********************/
 /* Function Prototypes */
 /***********************/
@@ -41,5 +52,11 @@ typedef enum {
 void configSwitches(void);
 
 uint8_t resetDAQ(void);
+uint16_t waitFrame(unsigned long frame_length);
+
+void markSwitchEdge(void);
+void recordSwitchLatency(void);
+uint8_t switchSamples(void);
+unsigned long switchLatency(uint8_t percentile);
 
 #endif
\ No newline at end of file
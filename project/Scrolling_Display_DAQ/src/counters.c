@@ -55,40 +55,8 @@ void writeCounter(uint8_t counter, int8_t starting_position) {
  * RETURN: VOID
  */
 void writeDigit(uint8_t digit, int8_t display_position) {
-	switch (digit) {
-		case 0 :
-			displayWrite(DISPLAY_0, display_position);
-			break;
-		case 1 :
-			displayWrite(DISPLAY_1, display_position);
-			break;
-		case 2 :
-			displayWrite(DISPLAY_2, display_position);
-			break;
-		case 3 :
-			displayWrite(DISPLAY_3, display_position);
-			break;
-		case 4 :
-			displayWrite(DISPLAY_4, display_position);
-			break;
-		case 5 :
-			displayWrite(DISPLAY_5, display_position);
-			break;
-		case 6 :
-			displayWrite(DISPLAY_6, display_position);
-			break;
-		case 7 :
-			displayWrite(DISPLAY_7, display_position);
-			break;
-		case 8 :
-			displayWrite(DISPLAY_8, display_position);
-			break;
-		case 9 :
-			displayWrite(DISPLAY_9, display_position);
-			break;
-		/* Counter Digit Isn't In the Specified Range. */
-		default:
-			break;
-	}
-	return;
+	/* Counter Digit Isn't In the Specified Range. */
+	if (digit > VALUE_DIGIT_MAX) return;
+
+	displayWrite(digit_encodings[digit], display_position);
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+ * File : firmware.c
+ * Purpose:	To Drive the Scrolling Display on a Microcontroller Without a Console.
+ * 		Input: Number of Scrolling Display Iterations Fixed at Compile Time.
+ *		Output:	Message and Counter Value Scrolls on Digital Display Screen.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "scroll.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+/* Board Support Package Provides the DAQ Library Functions on Channel 0. */
+#ifndef FIRMWARE_CONFIG
+#define FIRMWARE_CONFIG 0
+#endif
+
+#ifndef FIRMWARE_SCROLLS
+#define FIRMWARE_SCROLLS VALUE_DIGIT_MAX
+#endif
+
+/* Hosted Default of 1024 Playlist Entries Takes About 20 Kilobytes of RAM;
+ * the Freestanding Makefile Sets PLAYLIST_CAPACITY to 16. */
+#define FIRMWARE_PLAYLIST_MAX 64
+
+#if PLAYLIST_CAPACITY > FIRMWARE_PLAYLIST_MAX
+#error "Firmware Builds Must Set PLAYLIST_CAPACITY (See freestanding/Makefile)."
+#endif
+
+/*
+ * Main Function Drives the Firmware. Frames Are Computed From Their Index,
+ * so a Reset Seeks Back to the First Frame Instead of Growing the Stack.
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: never returns.
+ */
+int main(void) {
+	setupDAQ(FIRMWARE_CONFIG);
+
+	/* Measured Pacing Remains in daq_pacing for Telemetry. */
+	calibrateDAQ(DELAY_SHORT);
+
+	display_scrolls = FIRMWARE_SCROLLS;
+	resumeDisplay(phrase_message, PHRASE_LENGTH, display_scrolls, VALUE_MIN);
+
+	return FALSE;
+}
+
+/*
+ * Holds the Digital Displays On Once the Scrolling Display Has Finished.
+ *
+ * PARAM: VOID
+ * PRE: digital displays are all turned on to indicate end of program.
+ * POST: NULL (no side-effects)
+ * RETURN: never returns.
+ */
+void finishDisplay(void) {
+	while (TRUE) delay(DELAY_STANDARD);
+}
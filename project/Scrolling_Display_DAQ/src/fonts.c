@@ -0,0 +1,41 @@
+/*
+ * File: fonts.c
+ * Purpose: Contains the Read-Only Font Tables and Messages for the Scrolling Display.
+ *          Has No Dependency on the DAQ Library Functions, so Frames Can Be Computed Headless.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "scroll.h"
+
+/* Font Tables */
+
+const uint8_t digit_encodings[VALUE_DIGIT_MAX + 1] = {
+	DISPLAY_0,
+	DISPLAY_1,
+	DISPLAY_2,
+	DISPLAY_3,
+	DISPLAY_4,
+	DISPLAY_5,
+	DISPLAY_6,
+	DISPLAY_7,
+	DISPLAY_8,
+	DISPLAY_9
+};
+
+const uint8_t phrase_message[PHRASE_LENGTH] = {
+	DISPLAY_H,
+	DISPLAY_E,
+	DISPLAY_L,
+	DISPLAY_L,
+	DISPLAY_O
+};
+
+const uint8_t ending_message[ENDING_LENGTH] = {
+	DISPLAY_b,
+	DISPLAY_y,
+	DISPLAY_e,
+	DISPLAY_b,
+	DISPLAY_y,
+	DISPLAY_e
+};
@@ -0,0 +1,324 @@
+/*
+ * File: frames.c
+ * Purpose: To Compute Any Frame of the Scrolling Display Directly From its Index.
+ * 		Input: Message, Number of Scrolling Display Iterations and Frame Index.
+ *		Output: Contents of the Digital Displays at the Frame Index.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "scroll.h"
+
+/*
+ * Counts the Frames Written by a Complete Scrolling Display Program.
+ *
+ * PARAM: message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations.
+ * PRE: VALUE_MIN < message_length <= NUMBER_DISPLAYS; number_scrolls <= VALUE_COUNTER_MAX.
+ * POST: NULL (no side-effects)
+ * RETURN: number of frames from the starting message up to and including all displays on.
+ */
+uint16_t countFrames(uint8_t message_length, uint8_t number_scrolls) {
+	/* Local Variables */
+
+	uint8_t final_counter = (number_scrolls > 1) ? number_scrolls : 1;
+	uint8_t iterations = (number_scrolls > 1) ? number_scrolls - 1 : VALUE_MIN;
+	uint8_t single_iterations = (iterations > VALUE_DIGIT_MAX) ? VALUE_DIGIT_MAX : iterations;
+
+	uint16_t total_frames = message_length;
+
+	/* Complete and Separated Message Iterations. */
+	total_frames += single_iterations * ITERATION_FRAMES;
+	total_frames += (iterations - single_iterations) * DOUBLE_ITERATION_FRAMES;
+
+	/* Message is Shifted Off of the Digital Displays. */
+	total_frames += (NUMBER_DISPLAYS - message_length) + 1;
+	total_frames += message_length + ((final_counter > VALUE_DIGIT_MAX) ? MAX_COUNTER_LENGTH : MIN_COUNTER_LENGTH) + 1;
+
+	/* Ending Message and All Displays On. */
+	total_frames += ENDING_LENGTH + (NUMBER_DISPLAYS - ENDING_LENGTH) + 1 + ENDING_LENGTH + 1;
+	total_frames += 1;
+
+	return total_frames;
+}
+
+/*
+ * Computes the Contents of the Digital Displays at Any Frame Index
+ * Without Replaying the Preceding Frames.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations;
+ * 		  frame_index is a uint16_t representing the frame to compute;
+ * 		  frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE: VALUE_MIN < message_length <= NUMBER_DISPLAYS; number_scrolls <= VALUE_COUNTER_MAX.
+ * POST: frame holds the byte written to each display position at frame_index.
+ * RETURN: TRUE if frame_index < countFrames(message_length, number_scrolls); otherwise FALSE.
+ */
+uint8_t computeFrame(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, uint16_t frame_index, uint8_t* frame) {
+	/* Local Variables */
+
+	uint8_t final_counter = (number_scrolls > 1) ? number_scrolls : 1;
+	uint8_t iterations = (number_scrolls > 1) ? number_scrolls - 1 : VALUE_MIN;
+	uint8_t single_iterations = (iterations > VALUE_DIGIT_MAX) ? VALUE_DIGIT_MAX : iterations;
+
+	uint16_t segment_frames = FALSE;
+	uint8_t complete_frames = (NUMBER_DISPLAYS - message_length) + 1;
+	uint8_t counter = FALSE;
+
+	uint8_t display_position = FALSE;
+
+	/* Displays Not Written in a Frame Were Turned Off by an Earlier Frame. */
+	for (display_position = 0; display_position < NUMBER_DISPLAYS; display_position++)
+		frame[display_position] = DISPLAY_OFF;
+
+	/* Message is Scrolled Onto the Digital Displays. */
+	if (frame_index < message_length) {
+		startingFrame(message, message_length, (uint8_t)frame_index, frame);
+		return TRUE;
+	}
+	frame_index -= message_length;
+
+	/* Iterations With Single and Double Digit Counters Have Fixed Lengths. */
+	segment_frames = single_iterations * ITERATION_FRAMES;
+	if (frame_index < segment_frames) {
+		counter = (frame_index / ITERATION_FRAMES) + 1;
+		frame_index %= ITERATION_FRAMES;
+	}
+	else {
+		frame_index -= segment_frames;
+		segment_frames = (iterations - single_iterations) * DOUBLE_ITERATION_FRAMES;
+
+		if (frame_index < segment_frames) {
+			counter = (frame_index / DOUBLE_ITERATION_FRAMES) + (VALUE_DIGIT_MAX + 1);
+			frame_index %= DOUBLE_ITERATION_FRAMES;
+		}
+		else frame_index -= segment_frames;
+	}
+
+	if (counter != FALSE) {
+		if (frame_index < complete_frames) completeFrame(message, message_length, counter, (uint8_t)frame_index, frame);
+		else separatedFrame(message, message_length, counter, (uint8_t)(frame_index - complete_frames), frame);
+		return TRUE;
+	}
+
+	/* Message is Shifted Off of the Digital Displays. */
+	if (frame_index < complete_frames) {
+		completeFrame(message, message_length, final_counter, (uint8_t)frame_index, frame);
+		return TRUE;
+	}
+	frame_index -= complete_frames;
+
+	segment_frames = message_length + ((final_counter > VALUE_DIGIT_MAX) ? MAX_COUNTER_LENGTH : MIN_COUNTER_LENGTH) + 1;
+	if (frame_index < segment_frames) {
+		finishingFrame(message, message_length, final_counter, (uint8_t)frame_index, frame);
+		return TRUE;
+	}
+	frame_index -= segment_frames;
+
+	/* Ending Message is Scrolled Through the Digital Displays. */
+	if (frame_index < ENDING_LENGTH) {
+		startingFrame(ending_message, ENDING_LENGTH, (uint8_t)frame_index, frame);
+		return TRUE;
+	}
+	frame_index -= ENDING_LENGTH;
+
+	if (frame_index < (NUMBER_DISPLAYS - ENDING_LENGTH) + 1) {
+		completeFrame(ending_message, ENDING_LENGTH, FALSE, (uint8_t)frame_index, frame);
+		return TRUE;
+	}
+	frame_index -= (NUMBER_DISPLAYS - ENDING_LENGTH) + 1;
+
+	if (frame_index < ENDING_LENGTH + 1) {
+		finishingFrame(ending_message, ENDING_LENGTH, FALSE, (uint8_t)frame_index, frame);
+		return TRUE;
+	}
+	frame_index -= ENDING_LENGTH + 1;
+
+	/* All Digital Displays On to Indicate End of Program. */
+	if (frame_index == FALSE) {
+		for (display_position = 0; display_position < NUMBER_DISPLAYS; display_position++)
+			frame[display_position] = DISPLAY_ON;
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+/*
+ * Computes a Frame of the Message Being Scrolled Onto the Digital Displays.
+ * Mirrors a Single Iteration of shiftStartingMessage.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  frame_step is a uint8_t representing the iteration within shiftStartingMessage;
+ * 		  frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE: frame_step < message_length.
+ * POST: message is written to the appropriate positions of frame.
+ * RETURN: VOID
+ */
+void startingFrame(const uint8_t* message, uint8_t message_length, uint8_t frame_step, uint8_t* frame) {
+	/* Local Variables */
+
+	int8_t relative_position = FALSE;
+	int8_t message_end = frame_step - (message_length - 1);
+
+	for (relative_position = 0; relative_position < message_length; relative_position++)
+		frameWrite(message[(message_length - 1) - relative_position], relative_position + message_end, frame);
+}
+
+/*
+ * Computes a Frame of the Complete Message Being Shifted on the Digital Displays.
+ * Mirrors a Single Iteration of shiftCompleteMessage.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  counter is a uint8_t representing the current iteration of the scrolling display;
+ * 		  frame_step is a uint8_t representing the iteration within shiftCompleteMessage;
+ * 		  frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE: frame_step <= NUMBER_DISPLAYS - message_length.
+ * POST: message and counter are written to the appropriate positions of frame.
+ * RETURN: VOID
+ */
+void completeFrame(const uint8_t* message, uint8_t message_length, uint8_t counter, uint8_t frame_step, uint8_t* frame) {
+	/* Local Variables */
+
+	int8_t relative_position = FALSE;
+	int8_t display_position = FALSE;
+	int8_t starting_position = NUMBER_DISPLAYS - message_length;
+
+	int8_t message_end = frame_step;
+
+	/* Displays Surrounding the Message Remain Off. */
+	for (relative_position = 0; relative_position < message_length; relative_position++)
+		frameWrite(message[(message_length - 1) - relative_position], relative_position + message_end, frame);
+
+	if (counter != FALSE && message_end >= starting_position - 1) {
+		display_position = (counter > VALUE_DIGIT_MAX) ?
+			message_end - MAX_COUNTER_LENGTH : message_end - MIN_COUNTER_LENGTH;
+		frameCounter(counter, display_position, frame);
+	}
+	else if (counter > (VALUE_MIN + 1)) {
+		display_position = message_end + (message_length - 1) + LEADING_COUNTER_OFFSET;
+		frameCounter(counter - 1, display_position, frame);
+	}
+}
+
+/*
+ * Computes a Frame of the Message Being Separately Shifted on the Digital Displays.
+ * Mirrors a Single Iteration of shiftSeparatedMessage.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  counter is a uint8_t representing the current iteration of the scrolling display;
+ * 		  frame_step is a uint8_t representing the iteration within shiftSeparatedMessage;
+ * 		  frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE: frame_step < message_length - 1, or frame_step < message_length if counter > VALUE_DIGIT_MAX.
+ * POST: message and counter are written to the appropriate positions of frame.
+ * RETURN: VOID
+ */
+void separatedFrame(const uint8_t* message, uint8_t message_length, uint8_t counter, uint8_t frame_step, uint8_t* frame) {
+	/* Local Variables */
+
+	int8_t message_index = FALSE;
+
+	int8_t display_position = FALSE;
+	int8_t relative_position = FALSE;
+
+	int8_t message_start = ((counter > VALUE_DIGIT_MAX) ? VALUE_MIN - 1 : VALUE_MIN) + frame_step;
+	int8_t message_end = (counter > VALUE_DIGIT_MAX) ?
+		(message_start + 1) + (NUMBER_DISPLAYS - message_length) : message_start + (NUMBER_DISPLAYS - message_length);
+
+	for (display_position = 0; display_position < NUMBER_DISPLAYS; display_position++) {
+		relative_position = display_position - message_end;
+
+		/* Part of Message Moved To Right End of Displays. */
+		if (display_position <= message_start) {
+			message_index = message_start - display_position;
+			frameWrite(message[message_index], display_position, frame);
+		}
+		/* Remaining Message at Left End of Displays. */
+		else if (display_position > message_end) {
+			message_index = (counter > VALUE_DIGIT_MAX) ?
+				display_position - ((message_start + 1) + 2 * (relative_position - 1)) : display_position - (message_start + 2 * (relative_position - 1));
+
+			/* Messages Longer Than PHRASE_LENGTH Run Past the Message Start; Leave These Displays Off. */
+			if (message_index >= VALUE_MIN) frameWrite(message[message_index], display_position, frame);
+		}
+	}
+
+	frameCounter(counter, message_start + LEADING_COUNTER_OFFSET, frame);
+}
+
+/*
+ * Computes a Frame of the Message Being Scrolled Off the Digital Displays.
+ * Mirrors a Single Iteration of shiftFinishingMessage.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  counter is a uint8_t representing the current iteration of the scrolling display;
+ * 		  frame_step is a uint8_t representing the iteration within shiftFinishingMessage;
+ * 		  frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE: frame_step <= message_length + counter length.
+ * POST: message and counter are written to the appropriate positions of frame.
+ * RETURN: VOID
+ */
+void finishingFrame(const uint8_t* message, uint8_t message_length, uint8_t counter, uint8_t frame_step, uint8_t* frame) {
+	/* Local Variables */
+
+	int8_t message_index = FALSE;
+	int8_t display_position = FALSE;
+
+	int8_t maximum_length = FALSE;
+	int8_t message_end = frame_step + (NUMBER_DISPLAYS - message_length);
+
+	if (counter == FALSE) maximum_length = message_length;
+	else if (counter <= VALUE_DIGIT_MAX) maximum_length = message_length + MIN_COUNTER_LENGTH;
+	else maximum_length = message_length + MAX_COUNTER_LENGTH;
+
+	for (display_position = (NUMBER_DISPLAYS - 1); display_position >= NUMBER_DISPLAYS - maximum_length; display_position--) {
+		message_index = (message_length - 1) - (display_position - message_end);
+
+		if (message_index < message_length) frameWrite(message[message_index], display_position, frame);
+		else frameWrite(DISPLAY_OFF, display_position, frame);
+	}
+
+	if (counter != FALSE) frameCounter(counter, (NUMBER_DISPLAYS - maximum_length) + frame_step, frame);
+}
+
+/*
+ * Writes the Intended Counter to a Frame.
+ * Mirrors writeCounter.
+ *
+ * PARAM: counter is a uint8_t to be written to the frame;
+ *		  starting_position is an int8_t representing the index of the digital display
+ * 		  at which the least significant digit of the counter is written;
+ * 		  frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE:	VALUE_MIN <= counter <= VALUE_COUNTER_MAX
+ * POST: counter is written to frame from starting_position onwards.
+ * RETURN: VOID
+ */
+void frameCounter(uint8_t counter, int8_t starting_position, uint8_t* frame) {
+	int8_t display_position = starting_position;
+
+	if (starting_position >= NUMBER_DISPLAYS) return;
+
+	do {
+		frameWrite(digit_encodings[counter % (VALUE_DIGIT_MAX + 1)], display_position, frame);
+		counter /= (VALUE_DIGIT_MAX + 1);
+	} while (++display_position < NUMBER_DISPLAYS && counter != VALUE_MIN);
+}
+
+/*
+ * Writes a Byte to a Frame if the Display Position is Within Range.
+ *
+ * PARAM: data is a uint8_t to be written to the frame;
+ *		  display_position is an int8_t representing the index of the digital display;
+ * 		  frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE: NULL (no pre-conditions)
+ * POST: data is written to frame at display_position.
+ * RETURN: VOID
+ */
+void frameWrite(uint8_t data, int8_t display_position, uint8_t* frame) {
+	if (display_position >= VALUE_MIN && display_position < NUMBER_DISPLAYS) frame[display_position] = data;
+}
@@ -0,0 +1,99 @@
+/*
+ * File: pacing.c
+ * Purpose: To Adapt Scrolling Display Pacing to the Speed of the DAQ Module.
+ * 		Input: Time Taken by displayWrite and digitalRead Calls.
+ *		Output: Switch Polling Interval and Frame Length.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "pacing.h"
+
+/* Static Variables */
+
+/* Pacing Before Calibration Assumes DAQ Calls Cost Nothing. */
+DAQ_PACING daq_pacing = {
+	FALSE,
+	FALSE,
+
+	POLL_INTERVAL,
+	DELAY_SHORT,
+
+	NUMBER_DISPLAYS
+};
+
+/*
+ * Measures the Cost of displayWrite and digitalRead and Derives the Frame Pacing.
+ * The Frame Length is Kept as Requested. Slow DAQ Links Poll the Switches Less Often and
+ * Budget Fewer Changed Displays per Frame; Frames Changing More Displays Overrun, and the
+ * Engines Skip the Frames Whose Time Has Passed so the Scroll Speed Holds.
+ *
+ * PARAM: frame_length is an unsigned long representing the frame length in milliseconds.
+ * PRE: DAQ module has been set up; digital displays may be turned off.
+ * POST: daq_pacing holds the measured costs and derived pacing; all digital displays are off.
+ * RETURN: VOID
+ */
+void calibrateDAQ(unsigned long frame_length) {
+	/* Local Variables */
+
+	unsigned long frame_writes = FALSE;
+	unsigned long poll_interval = FALSE;
+
+	daq_pacing.write_micros = timeWrites();
+	daq_pacing.read_micros = timeReads();
+
+	daq_pacing.frame_length = frame_length;
+
+	/* Changed Displays Written in at Most 1 / FRAME_WRITE_SHARE of the Frame. */
+	frame_writes = (daq_pacing.write_micros > FALSE) ?
+		(frame_length * 1000) / (daq_pacing.write_micros * FRAME_WRITE_SHARE) : NUMBER_DISPLAYS;
+	if (frame_writes < 1) frame_writes = 1;
+	if (frame_writes > NUMBER_DISPLAYS) frame_writes = NUMBER_DISPLAYS;
+
+	daq_pacing.frame_writes = (uint8_t)frame_writes;
+
+	/* Each Poll Reads Both Switch Channels. */
+	poll_interval = (2 * daq_pacing.read_micros * POLL_DUTY_SHARE) / 1000;
+	if (poll_interval < POLL_INTERVAL) poll_interval = POLL_INTERVAL;
+	if (poll_interval > LATENCY_TARGET / 2) poll_interval = LATENCY_TARGET / 2;
+
+	daq_pacing.poll_interval = poll_interval;
+}
+
+/*
+ * Measures the Average Cost of a displayWrite Call.
+ *
+ * PARAM: VOID
+ * PRE: DAQ module has been set up.
+ * POST: all digital displays are off.
+ * RETURN: microseconds per displayWrite call, to the resolution of millis() / CALIBRATION_CALLS.
+ */
+unsigned long timeWrites(void) {
+	unsigned long start_time = FALSE;
+	uint8_t call_index = FALSE;
+
+	start_time = millis();
+	for (call_index = 0; call_index < CALIBRATION_CALLS; call_index++)
+		displayWrite(DISPLAY_OFF, call_index % NUMBER_DISPLAYS);
+
+	return ((millis() - start_time) * 1000) / CALIBRATION_CALLS;
+}
+
+/*
+ * Measures the Average Cost of a digitalRead Call.
+ *
+ * PARAM: VOID
+ * PRE: DAQ module has been set up.
+ * POST: NULL (no side-effects)
+ * RETURN: microseconds per digitalRead call, to the resolution of millis() / CALIBRATION_CALLS.
+ */
+unsigned long timeReads(void) {
+	unsigned long start_time = FALSE;
+	uint8_t call_index = FALSE;
+
+	start_time = millis();
+	for (call_index = 0; call_index < CALIBRATION_CALLS; call_index++)
+		digitalRead(call_index % 2 ? RUN_CHANNEL : RESET_CHANNEL);
+
+	return ((millis() - start_time) * 1000) / CALIBRATION_CALLS;
+}
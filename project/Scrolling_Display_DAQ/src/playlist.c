@@ -0,0 +1,351 @@
+/*
+ * File: playlist.c
+ * Purpose: To Schedule Several Messages on the Scrolling Display by Priority.
+ * 		Input: Messages With Priorities, Repeat Counts and Expiry Times.
+ *		Output: Highest Priority Message is Scrolled, Preempting Lower Priorities at Frame Boundaries.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "scroll.h"
+
+/* Static Variables */
+
+/* Binary Heap Ordered by playsBefore; playlist_items[0] is the Message Being Scrolled. */
+static PLAYLIST_ITEM playlist_items[PLAYLIST_CAPACITY];
+static uint16_t playlist_length = FALSE;
+
+static unsigned long queue_counter = FALSE;
+
+/* Single Producer Ring of Posted Messages; post_tail is Written Only by postMessage,
+ * post_head Only by insertPosts. One Slot is Left Empty to Tell a Full Ring From an Empty One. */
+static volatile PLAYLIST_ITEM posted_items[PLAYLIST_POSTS];
+static volatile uint8_t post_head = FALSE;
+static volatile uint8_t post_tail = FALSE;
+
+/*
+ * Adds a Message to the Playlist. A Message With Higher Priority Than the One
+ * Being Scrolled Takes Over at the Next Frame. Not Safe to Call While playPlaylist
+ * is Running on Another Thread or Interrupted by the Caller; Use postMessage Instead.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations;
+ * 		  priority is a uint8_t where larger values are scrolled first;
+ * 		  repeat_count is a uint8_t representing the number of plays, or REPEAT_FOREVER;
+ * 		  expiry_time is an unsigned long in milliseconds from millis(), or NEVER_EXPIRES.
+ * PRE: message remains valid until it is removed from the playlist.
+ * POST: message is queued in O(log n) time; a full playlist first removes its expired messages in O(n) time.
+ * RETURN: TRUE if the message was queued; FALSE if the playlist is full of unexpired messages.
+ */
+uint8_t queueMessage(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint8_t priority, uint8_t repeat_count, unsigned long expiry_time) {
+	PLAYLIST_ITEM item;
+
+	if (message_length == VALUE_MIN || message_length > NUMBER_DISPLAYS) return FALSE;
+
+	fillItem(&item, message, message_length, number_scrolls, priority, repeat_count, expiry_time);
+	return insertItem(&item);
+}
+
+/*
+ * Posts a Message to be Added to the Playlist at the Next Frame Boundary.
+ * Safe to Call From One Interrupt Handler or Thread While playPlaylist is Running.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations;
+ * 		  priority is a uint8_t where larger values are scrolled first;
+ * 		  repeat_count is a uint8_t representing the number of plays, or REPEAT_FOREVER;
+ * 		  expiry_time is an unsigned long in milliseconds from millis(), or NEVER_EXPIRES.
+ * PRE: message remains valid until it is removed from the playlist;
+ *		no other caller is posting a message at the same time.
+ * POST: message waits until the playlist has room for it.
+ * RETURN: TRUE if the message was posted; FALSE if PLAYLIST_POSTS messages are already waiting.
+ */
+uint8_t postMessage(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint8_t priority, uint8_t repeat_count, unsigned long expiry_time) {
+	PLAYLIST_ITEM item;
+	uint8_t next_tail = (post_tail + 1) % PLAYLIST_POSTS;
+
+	if (message_length == VALUE_MIN || message_length > NUMBER_DISPLAYS) return FALSE;
+	if (next_tail == post_head) return FALSE;
+
+	fillItem(&item, message, message_length, number_scrolls, priority, repeat_count, expiry_time);
+
+	/* Message is Written Before it is Published to insertPosts. */
+	posted_items[post_tail] = item;
+	post_tail = next_tail;
+
+	return TRUE;
+}
+
+/*
+ * Counts the Messages in the Playlist.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: number of queued messages, including expired messages not yet removed.
+ *		   Expired messages are removed once they reach the front or the playlist is full.
+ */
+uint16_t playlistLength(void) {
+	return playlist_length;
+}
+
+/*
+ * Computes the Next Frame of the Highest Priority Message. Expired Messages
+ * Are Removed When They Reach the Front of the Playlist, so Each Frame Costs
+ * O(1) Time Plus O(log n) for Each Message Which Finishes or Expires.
+ *
+ * PARAM: frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes.
+ * PRE: NULL (no pre-conditions)
+ * POST: frame holds the next frame; the message advances by one frame and is
+ *		 removed once it has been played repeat_count times.
+ * RETURN: TRUE if a frame was computed; FALSE if the playlist is empty.
+ */
+uint8_t playlistFrame(uint8_t* frame) {
+	PLAYLIST_ITEM* item = NULL;
+	unsigned long current_time = millis();
+
+	/* Frame Boundary is the Only Point Where Posted Messages Change the Playlist. */
+	insertPosts();
+
+	/* Drop Expired Messages From the Front of the Playlist. */
+	while (playlist_length > FALSE && playlist_items[0].expiry_time != NEVER_EXPIRES
+		&& current_time >= playlist_items[0].expiry_time) removeFirst();
+
+	if (playlist_length == FALSE) return FALSE;
+
+	item = &playlist_items[0];
+	computeFrame(item->message, item->message_length, item->number_scrolls, item->frame_index, frame);
+
+	/* Priority and Queue Order Are Unchanged, so the Heap Order Holds. */
+	if (++item->frame_index >= item->total_frames) {
+		item->frame_index = VALUE_MIN;
+
+		if (item->repeat_count != REPEAT_FOREVER && --item->repeat_count == FALSE) removeFirst();
+	}
+
+	return TRUE;
+}
+
+/*
+ * Scrolls the Playlist on the Digital Displays Until it is Empty.
+ * A Reset Event Restarts the Message Being Scrolled.
+ *
+ * PARAM: VOID
+ * PRE: DAQ module configured appropriately.
+ * POST: every queued message has been played or has expired.
+ * RETURN: VOID
+ */
+void playPlaylist(void) {
+	uint8_t current_frame[NUMBER_DISPLAYS];
+	uint8_t frame_written = FALSE;
+
+	uint16_t frame_periods = FALSE;
+
+	configSwitches();
+
+	while (TRUE) {
+		if (resetDAQ() == TRUE) {
+			configSwitches();
+			if (playlist_length > FALSE) playlist_items[0].frame_index = VALUE_MIN;
+		}
+
+		if (playlistFrame(current_frame) == FALSE) return;
+
+		writeFrame(current_frame, frame_written == FALSE);
+		frame_written = TRUE;
+
+		/* Frames Whose Time Passed During Slow Writes Are Skipped. */
+		frame_periods = waitFrame(daq_pacing.frame_length);
+		skipFrames(frame_periods - 1);
+	}
+}
+
+/*
+ * Skips Frames of the Message at the Front of the Playlist. The First and Last Frames
+ * of Each Play Are Never Skipped, so Every Message Starts and Ends in Full.
+ *
+ * PARAM: frame_count is a uint16_t representing the number of frames to skip.
+ * PRE: NULL (no pre-conditions)
+ * POST: message at the front of the playlist has advanced by up to frame_count frames.
+ * RETURN: VOID
+ */
+void skipFrames(uint16_t frame_count) {
+	PLAYLIST_ITEM* item = &playlist_items[0];
+
+	if (playlist_length == FALSE || frame_count == FALSE || item->frame_index == VALUE_MIN) return;
+
+	item->frame_index = (item->total_frames - item->frame_index > frame_count) ?
+		item->frame_index + frame_count : item->total_frames - 1;
+}
+
+/*
+ * Describes a Message Which Has Not Yet Been Played.
+ *
+ * PARAM: item is a pointer to the PLAYLIST_ITEM to fill;
+ *		  the remaining parameters are as for queueMessage.
+ * PRE: NULL (no pre-conditions)
+ * POST: item starts at its first frame; its queue order is assigned by insertItem.
+ * RETURN: VOID
+ */
+void fillItem(PLAYLIST_ITEM* item, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls,
+	uint8_t priority, uint8_t repeat_count, unsigned long expiry_time) {
+	item->message = message;
+	item->message_length = message_length;
+	item->number_scrolls = number_scrolls;
+
+	item->priority = priority;
+	item->repeat_count = repeat_count;
+	item->expiry_time = expiry_time;
+
+	item->frame_index = VALUE_MIN;
+	item->total_frames = countFrames(message_length, number_scrolls);
+}
+
+/*
+ * Inserts a Message Into the Playlist Heap.
+ *
+ * PARAM: item is a pointer to a PLAYLIST_ITEM filled by fillItem.
+ * PRE: NULL (no pre-conditions)
+ * POST: copy of item is queued in O(log n) time; a full playlist first removes its expired messages in O(n) time.
+ * RETURN: TRUE if the message was queued; FALSE if the playlist is full of unexpired messages.
+ */
+uint8_t insertItem(const PLAYLIST_ITEM* item) {
+	/* Expired Messages Behind the Front Otherwise Hold Their Place Until They Reach It. */
+	if (playlist_length >= PLAYLIST_CAPACITY) removeExpired(millis());
+
+	if (playlist_length >= PLAYLIST_CAPACITY) return FALSE;
+
+	playlist_items[playlist_length] = *item;
+	playlist_items[playlist_length].queue_order = queue_counter++;
+
+	siftUp(playlist_length++);
+
+	return TRUE;
+}
+
+/*
+ * Moves Posted Messages Into the Playlist in the Order They Were Posted.
+ *
+ * PARAM: VOID
+ * PRE: called only from the loop scrolling the playlist.
+ * POST: posted messages are queued until the playlist is full of unexpired messages;
+ *		 the rest wait for the next frame boundary.
+ * RETURN: VOID
+ */
+void insertPosts(void) {
+	PLAYLIST_ITEM item;
+
+	while (post_head != post_tail) {
+		item = posted_items[post_head];
+		if (insertItem(&item) == FALSE) return;
+
+		post_head = (post_head + 1) % PLAYLIST_POSTS;
+	}
+}
+
+/*
+ * Compares the Scheduling Order of Two Playlist Messages.
+ *
+ * PARAM: item and other are pointers to PLAYLIST_ITEMs.
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: TRUE if item has higher priority, or equal priority and was queued first; otherwise FALSE.
+ */
+uint8_t playsBefore(const PLAYLIST_ITEM* item, const PLAYLIST_ITEM* other) {
+	if (item->priority != other->priority) return item->priority > other->priority;
+
+	return item->queue_order < other->queue_order;
+}
+
+/*
+ * Moves a Playlist Message Towards the Front Until its Parent Plays Before it.
+ *
+ * PARAM: item_index is a uint16_t representing the position of the message in the heap.
+ * PRE: item_index < playlist_length.
+ * POST: heap order holds between item_index and its ancestors.
+ * RETURN: VOID
+ */
+void siftUp(uint16_t item_index) {
+	PLAYLIST_ITEM moved_item = playlist_items[item_index];
+	uint16_t parent_index = FALSE;
+
+	while (item_index > FALSE) {
+		parent_index = (item_index - 1) / 2;
+		if (!playsBefore(&moved_item, &playlist_items[parent_index])) break;
+
+		playlist_items[item_index] = playlist_items[parent_index];
+		item_index = parent_index;
+	}
+
+	playlist_items[item_index] = moved_item;
+}
+
+/*
+ * Moves a Playlist Message Towards the Back Until it Plays Before Both of its Children.
+ *
+ * PARAM: item_index is a uint16_t representing the position of the message in the heap.
+ * PRE: item_index < playlist_length.
+ * POST: heap order holds between item_index and its descendants.
+ * RETURN: VOID
+ */
+void siftDown(uint16_t item_index) {
+	PLAYLIST_ITEM moved_item = playlist_items[item_index];
+	uint16_t child_index = FALSE;
+
+	while ((child_index = 2 * item_index + 1) < playlist_length) {
+		/* Compare Against the Child Which Plays First. */
+		if (child_index + 1 < playlist_length && playsBefore(&playlist_items[child_index + 1], &playlist_items[child_index]))
+			child_index++;
+
+		if (!playsBefore(&playlist_items[child_index], &moved_item)) break;
+
+		playlist_items[item_index] = playlist_items[child_index];
+		item_index = child_index;
+	}
+
+	playlist_items[item_index] = moved_item;
+}
+
+/*
+ * Removes the Message at the Front of the Playlist.
+ *
+ * PARAM: VOID
+ * PRE: playlist_length > FALSE.
+ * POST: next message in scheduling order is at the front of the playlist.
+ * RETURN: VOID
+ */
+void removeFirst(void) {
+	if (--playlist_length == FALSE) return;
+
+	playlist_items[0] = playlist_items[playlist_length];
+	siftDown(0);
+}
+
+/*
+ * Removes Every Expired Message From the Playlist and Restores the Heap Order.
+ *
+ * PARAM: current_time is an unsigned long in milliseconds from millis().
+ * PRE: NULL (no pre-conditions)
+ * POST: no message in the playlist has expired; message being scrolled keeps its frame index.
+ * RETURN: VOID
+ */
+void removeExpired(unsigned long current_time) {
+	uint16_t item_index = FALSE;
+	uint16_t kept_length = FALSE;
+
+	for (item_index = 0; item_index < playlist_length; item_index++) {
+		if (playlist_items[item_index].expiry_time != NEVER_EXPIRES
+			&& current_time >= playlist_items[item_index].expiry_time) continue;
+
+		playlist_items[kept_length++] = playlist_items[item_index];
+	}
+
+	playlist_length = kept_length;
+
+	/* Rebuild the Heap From the Last Parent Upwards in O(n) Time. */
+	for (item_index = playlist_length / 2; item_index > FALSE; item_index--) siftDown(item_index - 1);
+}
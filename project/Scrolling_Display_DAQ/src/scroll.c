@@ -0,0 +1,430 @@
+/*
+ * File : scroll.c
+ * Purpose:	To Scroll a Message on 8-Segment Digital Displays.
+ * 		Input: Message and Number of Scrolling Display Iterations.
+ *		Output:	Message and Counter Value Scrolls on Digital Display Screen.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "scroll.h"
+
+/* Static Variables */
+
+uint8_t display_scrolls;
+
+/* Frame Index is Shared With Interrupts and Threads Which Seek the Scrolling Display. */
+static volatile uint16_t display_frame;
+static volatile uint16_t seek_frame;
+static volatile uint8_t seek_pending;
+
+static uint8_t written_frame[NUMBER_DISPLAYS];
+
+/*
+ * Scrolls a Message on the Digital Displays.
+ * Reference Implementation of the Display Cases; the Console Program and Firmware
+ * Scroll Frames Computed by computeFrame, Which the Differential Harness Checks Against it.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is an int8_t which represents the number of iterations;
+ * PRE: DAQ module configured appropriately; VALUE_MIN <= number_scrolls <= VALUE_COUNTER_MAX.
+ * POST: message is iteratively scrolled on the digital displays.
+ * RETURN: VOID
+ */
+void scrollDisplay(const uint8_t* message, uint8_t message_length, int8_t number_scrolls) {
+	uint8_t counter = FALSE;
+
+	configSwitches();
+
+	/* Turn Off All Digital Displays. */
+	refreshDisplay(VALUE_MIN, NUMBER_DISPLAYS, FALSE);
+
+	shiftStartingMessage(message, message_length);
+
+	/* Iteratively Scroll Message on Digital Displays. */
+	while (++counter < number_scrolls) {
+		shiftCompleteMessage(message, message_length, counter);
+		shiftSeparatedMessage(message, message_length, counter);
+	}
+
+	/* Conclude Scrolling Display Iterations. */
+	endDisplay(message, message_length, counter);
+}
+
+/*
+ * Scrolls a Message on the Digital Displays Starting From Any Frame.
+ * Frames are Computed Directly From Their Index, so the Scrolling Display
+ * Resumes Immediately Without Replaying the Preceding Frames.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations;
+ * 		  frame_index is a uint16_t representing the first frame to write.
+ * PRE: DAQ module configured appropriately; VALUE_MIN <= number_scrolls <= VALUE_COUNTER_MAX.
+ * POST: message is scrolled on the digital displays from frame_index onwards.
+ * RETURN: VOID
+ */
+void resumeDisplay(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, uint16_t frame_index) {
+	/* Local Variables */
+
+	uint8_t current_frame[NUMBER_DISPLAYS];
+	uint8_t frame_written = FALSE;
+
+	uint16_t total_frames = countFrames(message_length, number_scrolls);
+	uint16_t frame_periods = FALSE;
+
+	configSwitches();
+
+	/* Seeks Requested Before the Scrolling Display Started Are Superseded by frame_index. */
+	seek_pending = FALSE;
+	display_frame = frame_index;
+
+	while (display_frame < total_frames) {
+		if (resetDAQ() == TRUE) {
+			configSwitches();
+			display_frame = VALUE_MIN;
+		}
+
+		/* Clear the Request Before Reading it, so a Seek Arriving in Between is Kept for the Next Frame. */
+		if (seek_pending == TRUE) {
+			seek_pending = FALSE;
+			display_frame = (seek_frame < total_frames) ? seek_frame : total_frames - 1;
+		}
+
+		computeFrame(message, message_length, number_scrolls, display_frame, current_frame);
+
+		/* First Frame Overwrites Whatever the Digital Displays Were Showing. */
+		writeFrame(current_frame, frame_written == FALSE);
+		frame_written = TRUE;
+
+		/* Last Frame Turns All Digital Displays On. */
+		if (display_frame + 1 >= total_frames) {
+			display_frame = total_frames;
+			break;
+		}
+
+		/* Frames Whose Time Passed During Slow Writes Are Skipped; the Last Frame is Always Written. */
+		frame_periods = waitFrame(daq_pacing.frame_length);
+		display_frame = (total_frames - display_frame > frame_periods) ? display_frame + frame_periods : total_frames - 1;
+	}
+
+	finishDisplay();
+}
+
+/*
+ * Moves the Running Scrolling Display to Any Frame. resumeDisplay Writes frame_index
+ * at its Next Frame Boundary, so Several Displays Lock to a Shared Frame Index by Seeking
+ * to displayFrame() of a Leading Display. Safe to Call From an Interrupt or Another Thread.
+ *
+ * PARAM: frame_index is a uint16_t representing the next frame to write.
+ * PRE: resumeDisplay is running.
+ * POST: next frame is frame_index, or the last frame if frame_index is out of range.
+ * RETURN: VOID
+ */
+void seekDisplay(uint16_t frame_index) {
+	seek_frame = frame_index;
+	seek_pending = TRUE;
+}
+
+/*
+ * Reads the Frame Index of the Running Scrolling Display.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: index of the next frame resumeDisplay writes.
+ */
+uint16_t displayFrame(void) {
+	return display_frame;
+}
+
+/*
+ * Writes a Frame to the Digital Displays. Every Position Which Changed is Written,
+ * so a Frame is Never Left Partly Written; Frames Changing More Than daq_pacing.frame_writes
+ * Positions Overrun Their Frame, and waitFrame Reports the Frames Skipped.
+ *
+ * PARAM: frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes;
+ * 		  write_all is a uint8_t which is TRUE to write every display position.
+ * PRE: DAQ module configured appropriately.
+ * POST: digital displays show frame; only positions which changed since the
+ *		 last written frame are written, unless write_all is TRUE.
+ * RETURN: VOID
+ */
+void writeFrame(const uint8_t* frame, uint8_t write_all) {
+	uint8_t display_position = FALSE;
+
+	for (display_position = 0; display_position < NUMBER_DISPLAYS; display_position++) {
+		if (write_all == TRUE || frame[display_position] != written_frame[display_position]) {
+			displayWrite(frame[display_position], display_position);
+			written_frame[display_position] = frame[display_position];
+		}
+	}
+}
+
+/*
+ * Concludes Scrolling Display Iterations and Scrolls an Ending Message.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  counter is a uint8_t representing the current iteration of the scrolling display.
+ * PRE: message is written to appropriate digital displays; VALUE_MIN <= counter <= VALUE_COUNTER_MAX.
+ * POST: digital displays are all turned on to indicate end of program.
+ * RETURN: VOID
+ */
+void endDisplay(const uint8_t* message, uint8_t message_length, uint8_t counter) {
+	/* Shift Message Off of Digital Displays. */
+	shiftCompleteMessage(message, message_length, counter);
+	shiftFinishingMessage(message, message_length, counter);
+
+	/* Shift Ending Message to Indicate End of Program. */
+	shiftStartingMessage(ending_message, ENDING_LENGTH);
+	shiftCompleteMessage(ending_message, ENDING_LENGTH, FALSE);
+	shiftFinishingMessage(ending_message, ENDING_LENGTH, FALSE);
+
+	/* Turn All Digital Displays On. */
+	refreshDisplay(VALUE_MIN, NUMBER_DISPLAYS, TRUE);
+
+	finishDisplay();
+}
+
+/*
+ * Message is Scrolled Onto the Digital Displays.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * PRE: all digital displays are turned off.
+ * POST: message is written to appropriate digital displays;
+ * RETURN: VOID
+ */
+void shiftStartingMessage(const uint8_t* message, uint8_t message_length) {
+	/* Local Variables */
+
+	int8_t message_index = FALSE;
+
+	int8_t relative_position = FALSE;
+	int8_t display_position = FALSE;
+
+	int8_t message_end = - (message_length - 1);
+
+	/* Shift Message Onto the Digital Displays. */
+	while (message_end <= VALUE_MIN) {
+		if (resetDAQ() == TRUE) scrollDisplay(message, message_length, display_scrolls);
+
+		/* Write Message to Digital Displays. */
+		for (relative_position = 0; relative_position < message_length; relative_position++) {
+			message_index = (message_length - 1) - relative_position;
+
+			/* Shift Message Leftwards. */
+			display_position = relative_position + message_end;
+
+			/* Write Message to Display Positions Within Specified Range. */
+			if (display_position >= VALUE_MIN) displayWrite(message[message_index], display_position);
+		}
+
+		/* Prepare to Shift Message. */
+		message_end++;
+
+		waitFrame(daq_pacing.frame_length);
+	}
+}
+
+/*
+ * Message is Scrolled Off the Digital Displays.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  counter is a uint8_t representing the current iteration of the scrolling display.
+ * PRE: message is written to appropriate digital displays; VALUE_MIN <= counter <= VALUE_COUNTER_MAX.
+ * POST: all digital displays are turned off to indicate end of scrolling iterations.
+ */
+void shiftFinishingMessage(const uint8_t* message, uint8_t message_length, uint8_t counter) {
+	/* Local Variables */
+
+	int8_t shift_index = FALSE;
+	int8_t message_index = FALSE;
+
+	int8_t relative_position = FALSE;
+	int8_t starting_position = FALSE;
+	int8_t display_position = FALSE;
+
+	int8_t maximum_length = FALSE;
+	int8_t message_end = FALSE;
+
+	if (counter == FALSE) maximum_length = message_length;
+	else if (counter <= VALUE_DIGIT_MAX) maximum_length = message_length + MIN_COUNTER_LENGTH;
+	else if (counter <= VALUE_COUNTER_MAX) maximum_length = message_length + MAX_COUNTER_LENGTH;
+
+	starting_position = NUMBER_DISPLAYS - maximum_length;
+
+	/* Shift Message Off of the Digital Displays. */
+	while (shift_index <= maximum_length) {
+		if (resetDAQ() == TRUE) scrollDisplay(message, message_length, display_scrolls);
+
+		message_end = shift_index + (NUMBER_DISPLAYS - message_length);
+
+		for (display_position = (NUMBER_DISPLAYS - 1); display_position >= starting_position; display_position--) {
+			relative_position = display_position - message_end;
+			message_index = (message_length - 1) - relative_position;
+
+			/* Write Message to the Appropriate Display Positions. */
+			if (message_index < message_length) displayWrite(message[message_index], display_position);
+			else displayWrite(DISPLAY_OFF, display_position);
+		}
+
+		/* Write Counter to Appropriate Display Position. */
+		if (counter != FALSE) {
+			display_position = (NUMBER_DISPLAYS - maximum_length) + shift_index;
+			writeCounter(counter, display_position);
+		}
+
+		/* Prepare to Shift Message. */
+		shift_index++;
+
+		waitFrame(daq_pacing.frame_length);
+	}
+}
+
+/*
+ * Complete Message is Shifted on Digital Displays.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  counter is a uint8_t representing the current iteration of the scrolling display.
+ * PRE: message is written to appropriate digital displays; VALUE_MIN <= counter <= VALUE_COUNTER_MAX.
+ * POST: message is written to appropriate digital displays;
+ * RETURN: VOID
+ */
+void shiftCompleteMessage(const uint8_t* message, uint8_t message_length, uint8_t counter) {
+	/* Local Variables */
+
+	int8_t message_index = FALSE;
+
+	int8_t relative_position = FALSE;
+	int8_t display_position = FALSE;
+	int8_t starting_position = NUMBER_DISPLAYS - message_length;
+
+	int8_t message_end = FALSE;
+
+	/* Shift Message Leftwards On the Digital Displays. */
+	while (message_end <= starting_position) {
+		if (resetDAQ() == TRUE) scrollDisplay(message, message_length, display_scrolls);
+
+		for (relative_position = 0; relative_position < message_length; relative_position++) {
+			message_index = (message_length - 1) - relative_position;
+			display_position = relative_position + message_end;
+
+			/* Write Message to the Appropriate Display Positions. */
+			displayWrite(message[message_index], display_position);
+		}
+
+		/* Turn Off Digital Displays Surrounding the Message. */
+		refreshDisplay(VALUE_MIN, message_end, FALSE);
+		refreshDisplay(message_end + message_length, NUMBER_DISPLAYS, FALSE);
+
+		/* Write Counter to Appropriate Display Position. */
+		if (counter != FALSE && message_end >= starting_position - 1) {
+			display_position = (counter > VALUE_DIGIT_MAX) ?
+				message_end - MAX_COUNTER_LENGTH : message_end - MIN_COUNTER_LENGTH;
+			writeCounter(counter, display_position);
+		}
+		else if (counter > (VALUE_MIN + 1)) {
+			display_position = message_end + (message_length - 1) + LEADING_COUNTER_OFFSET;
+			writeCounter(counter - 1, display_position);
+		}
+
+		/* Prepare to Shift Message. */
+		message_end++;
+
+		waitFrame(daq_pacing.frame_length);
+	}
+}
+
+
+/*
+ * Broken Phrase is Written to Appropriate Digital Displays to Create Scrolling Effect.
+ *
+ * PARAM: counter is a uint8_t representing the current loop iteration.
+ * PRE: VALUE_MIN <= counter <= VALUE_DIGIT_MAX;
+ *	    phrase occupies digital display at PHRASE_LENGTH ... NUMBER_DISPLAYS.
+ * POST: phrase occupies digital display at VALUE_MIN ... ((PHRASE_LENGTH - 1) - 1)
+ *       and digital display at (NUMBER_DISPLAYS - 1); creates a "broken" phrase effect.
+ * RETURN: VOID
+ */
+
+/*
+ * Message is Separately Shifted on Digital Displays.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  counter is a uint8_t representing the current iteration of the scrolling display.
+ * PRE: message is written to appropriate digital displays; VALUE_MIN <= counter <= VALUE_COUNTER_MAX.
+ * POST: message is written to appropriate digital displays;
+ * RETURN: VOID
+ */
+void shiftSeparatedMessage(const uint8_t* message, uint8_t message_length, uint8_t counter) {
+	/* Local Variables */
+
+	int8_t message_index = FALSE;
+
+	int8_t display_position = FALSE;
+	int8_t relative_position = FALSE;
+
+	int8_t message_start = FALSE;
+	int8_t message_end = FALSE;
+
+	message_start = (counter > VALUE_DIGIT_MAX) ? VALUE_MIN - 1 : VALUE_MIN;
+
+	/* Shift Message Leftwards On the Digital Displays. */
+	while (message_start < (message_length - 1)) {
+		if (resetDAQ() == TRUE) scrollDisplay(message, message_length, display_scrolls);
+
+		message_end = (counter > VALUE_DIGIT_MAX) ?
+			(message_start + 1) + (NUMBER_DISPLAYS - message_length) : message_start + (NUMBER_DISPLAYS - message_length);
+
+		for (display_position = 0; display_position < NUMBER_DISPLAYS; display_position++) {
+			relative_position = display_position - message_end;
+			/* Part of Message Moved To Right End of Displays. */
+			if (display_position <= message_start) {
+				message_index = message_start - display_position;
+				/* Write Message to the Appropriate Display Positions. */
+				displayWrite(message[message_index], display_position);
+			}
+			/* Remaining Message at Left End of Displays. */
+			else if (display_position > message_end) {
+				message_index = (counter > VALUE_DIGIT_MAX) ?
+					display_position - ((message_start + 1) + 2 * (relative_position - 1)) : display_position - (message_start + 2 * (relative_position - 1));
+				/* Write Message to the Appropriate Display Positions. */
+				displayWrite(message[message_index], display_position);
+			}
+		}
+
+		display_position = message_start + LEADING_COUNTER_OFFSET;
+
+		/* Write Counter to Appropriate Display Position. */
+		refreshDisplay(message_start + 1, message_end + 1, FALSE);
+		writeCounter(counter, display_position);
+
+		/* Prepare to Shift Message. */
+		message_start++;
+
+		waitFrame(daq_pacing.frame_length);
+		}
+}
+
+/*
+ * Turns On/Off Specified Digital Displays.
+ *
+ * PARAM: refresh_start and refresh_end are uint8_ts which represent
+ * 		  the left and right bounds of displays to be turned off respectively.
+ * PRE:	VALUE_MIN <= refresh_start < refresh_end < NUMBER_DISPLAYS
+ * POST: digital display at refresh_start ... digital display at refresh_end
+ * 		 are all either turned on or off.
+ * RETURN: VOID
+ */
+void refreshDisplay(uint8_t refresh_start, uint8_t refresh_end, uint8_t turn_on) {
+	for (uint8_t refresh_index = refresh_start; refresh_index < refresh_end; refresh_index++) {
+		if (turn_on == FALSE) displayWrite(DISPLAY_OFF, refresh_index);
+		else if (turn_on == TRUE) displayWrite(DISPLAY_ON, refresh_index);
+	}
+}
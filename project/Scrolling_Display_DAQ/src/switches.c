@@ -8,6 +8,20 @@
  */
 
 #include "switches.h"
+#include "pacing.h"
+
+/* Static Variables */
+
+/* Frame Writes Happen Between Frame Waits, so Frames Are Timed From the Last Wait. */
+static unsigned long frame_start = FALSE;
+
+static unsigned long switch_edge = FALSE;
+static uint8_t edge_pending = FALSE;
+static uint8_t edge_confirmed = FALSE;
+
+static unsigned long latency_samples[LATENCY_SAMPLES];
+static uint8_t latency_count = FALSE;
+static uint8_t latency_index = FALSE;
 
 /*
  * Checks that the DAQ Switch Channels Are Configured With Default Settings.
@@ -25,6 +39,8 @@ void configSwitches(void) {
 		run_event = digitalRead(RUN_CHANNEL);
 		reset_event = digitalRead(RESET_CHANNEL);
 	} while (run_event == FALSE || reset_event == TRUE);
+
+	frame_start = millis();
 }
 
 /*
@@ -38,13 +54,153 @@ void configSwitches(void) {
 uint8_t resetDAQ(void) {
 	uint8_t run_event = FALSE;
 	uint8_t reset_event = FALSE;
+	uint8_t pause_event = FALSE;
 
 	do {
 		run_event = digitalRead(RUN_CHANNEL);
+		if (run_event == FALSE) pause_event = TRUE;
 
 		while (digitalRead(RESET_CHANNEL) == TRUE) reset_event = TRUE;
-		if (reset_event == TRUE) return TRUE;
+		if (reset_event == TRUE) {
+			/* Reset Takes Effect on Release of the Switch, so its Latency is Measured From the Release.
+			 * This Replaces the Press Seen by waitFrame; Time the Switch is Held is Not Counted. */
+			markSwitchEdge();
+			edge_confirmed = TRUE;
+			return TRUE;
+		}
 	} while (run_event == FALSE);
 
+	/* Resuming From a Pause is the Edge the Next Frame Responds To. */
+	if (pause_event == TRUE) {
+		markSwitchEdge();
+		edge_confirmed = TRUE;
+		frame_start = millis();
+	}
+	/* Edge Seen by waitFrame Was a Glitch; Edges of Real Events Stay Pending Until Recorded. */
+	else if (edge_confirmed == FALSE) edge_pending = FALSE;
+
 	return FALSE;
 }
+
+/*
+ * Waits Until the Frame Has Lasted frame_length While Polling the Switch Channels.
+ * Frames Start on a Grid of frame_length, and Time Spent Writing the Frame Counts Towards
+ * its Length. Writes Which Overrun the Frame End the Wait at Once, and the Grid Moves On by
+ * Every Frame Whose Time Has Passed, so Slow DAQ Links Hold the Scroll Speed.
+ * The Wait is Cut Short as Soon as a Reset or Pause Event is Observed,
+ * so the Next Call to resetDAQ Responds Without Waiting for the Frame to End.
+ *
+ * PARAM: frame_length is an unsigned long representing the frame length in milliseconds.
+ * PRE: DAQ module for scrolling display program has been initialized;
+ *		current frame has been written to the digital displays.
+ * POST: switch latency is recorded if a switch edge was pending; next frame starts.
+ * RETURN: number of frame periods the frame lasted, at least 1; 1 if a switch event cut the frame short.
+ */
+uint16_t waitFrame(unsigned long frame_length) {
+	unsigned long frame_periods = FALSE;
+
+	recordSwitchLatency();
+
+	/* Frame Writes Overran the Frame; the Next Frame Starts in the Period the Clock Has Reached. */
+	if (millis() - frame_start >= frame_length) {
+		frame_periods = (millis() - frame_start) / frame_length;
+		frame_start += frame_periods * frame_length;
+		return (frame_periods > UINT16_MAX) ? UINT16_MAX : (uint16_t)frame_periods;
+	}
+
+	while (millis() - frame_start < frame_length) {
+		if (digitalRead(RESET_CHANNEL) == TRUE || digitalRead(RUN_CHANNEL) == FALSE) {
+			/* Edge is Confirmed Once resetDAQ Sees the Event. */
+			markSwitchEdge();
+			edge_confirmed = FALSE;
+			frame_start = millis();
+			return 1;
+		}
+
+		delay(daq_pacing.poll_interval);
+	}
+
+	frame_start += frame_length;
+	return 1;
+}
+
+/*
+ * Timestamps the Most Recent Switch Edge.
+ *
+ * PARAM: VOID
+ * PRE: DAQ module for scrolling display program has been initialized.
+ * POST: switch edge is pending until the next frame is written.
+ * RETURN: VOID
+ */
+void markSwitchEdge(void) {
+	switch_edge = millis();
+	edge_pending = TRUE;
+}
+
+/*
+ * Records the Latency From the Pending Switch Edge to the First Written Frame.
+ *
+ * PARAM: VOID
+ * PRE: first frame following the switch edge has been written to the digital displays.
+ * POST: latency sample overwrites the oldest of LATENCY_SAMPLES samples.
+ * RETURN: VOID
+ */
+void recordSwitchLatency(void) {
+	if (edge_pending == FALSE) return;
+
+	latency_samples[latency_index] = millis() - switch_edge;
+	latency_index = (latency_index + 1) % LATENCY_SAMPLES;
+	if (latency_count < LATENCY_SAMPLES) latency_count++;
+
+	edge_pending = FALSE;
+	edge_confirmed = FALSE;
+}
+
+/*
+ * Counts the Recorded Switch Latencies.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: number of latency samples recorded, up to LATENCY_SAMPLES.
+ */
+uint8_t switchSamples(void) {
+	return latency_count;
+}
+
+/*
+ * Computes a Percentile of the Recorded Switch Latencies. Latencies Run From the Release of
+ * the Reset Switch or the Resume From a Pause to the First Frame Written in Response;
+ * Time Spent Holding the Reset Switch or Paused is Not Included.
+ *
+ * PARAM: percentile is a uint8_t in the range 0 ... 100.
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: latency in milliseconds at the given percentile; 0 if no samples are recorded.
+ */
+unsigned long switchLatency(uint8_t percentile) {
+	unsigned long sorted_samples[LATENCY_SAMPLES];
+	unsigned long current_sample = FALSE;
+
+	int16_t sample_index = FALSE;
+	int16_t insert_index = FALSE;
+
+	if (latency_count == FALSE) return FALSE;
+	if (percentile > 100) percentile = 100;
+
+	/* Insertion Sort is Sufficient for LATENCY_SAMPLES Samples. */
+	for (sample_index = 0; sample_index < latency_count; sample_index++) {
+		current_sample = latency_samples[sample_index];
+
+		for (insert_index = sample_index; insert_index > 0 && sorted_samples[insert_index - 1] > current_sample; insert_index--)
+			sorted_samples[insert_index] = sorted_samples[insert_index - 1];
+
+		sorted_samples[insert_index] = current_sample;
+	}
+
+	/* Nearest-Rank Percentile. */
+	sample_index = (percentile * latency_count + 99) / 100;
+	if (sample_index > FALSE) sample_index--;
+
+	return sorted_samples[sample_index];
+}
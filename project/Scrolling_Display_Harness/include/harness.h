@@ -0,0 +1,90 @@
+/*
+ * File: harness.h
+ * Purpose: Contains Precompiler Directives, Structures
+ *          and Function Prototypes for Comparing Candidate Frame Engines
+ *          Against the Reference shift* Functions.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef HARNESS_H
+#define HARNESS_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <string.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <Windows.h>
+
+#include "scroll.h"
+#include "mock.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+#define PROGRAM_ERROR -1
+
+/****************/
+/* Enumerations */
+/****************/
+
+typedef enum {
+	MAX_FRAMES = 1024,
+	MAX_THREADS = 64,
+	MAX_CANDIDATES = 8,
+
+	/* Every Message Length and Every Number of Iterations. */
+	SWEEP_CONFIGS = NUMBER_DISPLAYS * (VALUE_COUNTER_MAX + 1)
+} HARNESS_LIMITS;
+
+/**************/
+/* Structures */
+/**************/
+
+/* Frames Captured From an Engine at Each Frame Boundary. */
+typedef struct {
+	uint8_t frames[MAX_FRAMES][NUMBER_DISPLAYS];
+	uint16_t frame_count;
+	uint8_t overflowed;
+} FRAME_STREAM;
+
+/* Candidate Engine Writes Every Frame of a Scrolling Display Program to stream. */
+typedef struct {
+	const char* engine_name;
+	void (*renderStream)(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, FRAME_STREAM* stream);
+} CANDIDATE_ENGINE;
+
+/* Results Accumulated by a Sweep Thread. */
+typedef struct {
+	LONGLONG reference_ticks;
+	LONGLONG candidate_ticks[MAX_CANDIDATES];
+
+	unsigned long frames_compared;
+	unsigned long mismatches[MAX_CANDIDATES];
+} SWEEP_RESULT;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+DWORD WINAPI sweepConfigs(LPVOID sweep_result);
+
+uint8_t compareStreams(const FRAME_STREAM* reference, const FRAME_STREAM* candidate,
+	const char* engine_name, uint8_t message_length, uint8_t number_scrolls);
+
+void referenceStream(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, FRAME_STREAM* stream);
+void computeStream(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, FRAME_STREAM* stream);
+void runReference(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls);
+
+void captureFrame(void);
+
+LONGLONG readTicks(void);
+
+#endif
@@ -0,0 +1,323 @@
+/*
+ * File : harness.c
+ * Purpose:	To Prove Candidate Frame Engines Write Exactly the Same Frames as the Reference shift* Functions.
+ * 		Input: NULL; Sweeps Every Message Length and Every Number of Iterations.
+ *		Output:	Mismatching Frames and the Speedup of Each Candidate Over the Reference.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "harness.h"
+
+/* Static Variables */
+
+/*
+ * Sweep Message. Positions Before the Message Are DISPLAY_OFF Because
+ * shiftSeparatedMessage Reads Before the Start of Messages Longer Than PHRASE_LENGTH.
+ */
+static const uint8_t sweep_buffer[2 * NUMBER_DISPLAYS] = {
+	DISPLAY_OFF, DISPLAY_OFF, DISPLAY_OFF, DISPLAY_OFF,
+	DISPLAY_OFF, DISPLAY_OFF, DISPLAY_OFF, DISPLAY_OFF,
+
+	DISPLAY_H,
+	DISPLAY_E,
+	DISPLAY_L,
+	DISPLAY_O,
+	DISPLAY_b,
+	DISPLAY_y,
+	DISPLAY_e,
+	DISPLAY_2
+};
+
+static const uint8_t* sweep_message = sweep_buffer + NUMBER_DISPLAYS;
+
+static const CANDIDATE_ENGINE candidate_engines[] = {
+	{ "computeFrame", computeStream }
+};
+
+static const uint8_t candidate_count = sizeof(candidate_engines) / sizeof(candidate_engines[0]);
+
+/* Next Configuration to Sweep, Shared by All Threads. */
+static volatile LONG next_config = -1;
+
+/* Stream Being Captured by the Thread Running the Reference. */
+static THREAD_LOCAL FRAME_STREAM* mock_stream;
+
+/* Last Frame of the Reference is Written Just Before it Finishes. */
+static const MOCK_HOOKS reference_hooks = { NULL, NULL, captureFrame };
+
+/*
+ * Main Function Drives the Program. Configurations Are Swept in Parallel
+ * on One Thread per Processor.
+ * PRE: NULL (no pre-conditions)
+ * POST: mismatches and speedups printed to stdout.
+ * RETURN: 0 if every candidate matched the reference; otherwise PROGRAM_ERROR.
+ */
+int main(void) {
+	/* Local Variables */
+
+	SWEEP_RESULT* sweep_results = NULL;
+	HANDLE sweep_threads[MAX_THREADS];
+	SYSTEM_INFO system_info;
+
+	LONGLONG reference_ticks = FALSE;
+	LONGLONG candidate_ticks = FALSE;
+
+	unsigned long frames_compared = FALSE;
+	unsigned long mismatches = FALSE;
+	unsigned long total_mismatches = FALSE;
+
+	uint16_t number_threads = FALSE;
+	uint16_t thread_index = FALSE;
+	uint8_t candidate_index = FALSE;
+
+	GetSystemInfo(&system_info);
+	number_threads = (uint16_t)system_info.dwNumberOfProcessors;
+	if (number_threads > MAX_THREADS) number_threads = MAX_THREADS;
+	if (number_threads == FALSE) number_threads = 1;
+
+	sweep_results = calloc(number_threads, sizeof(SWEEP_RESULT));
+	if (sweep_results == NULL) {
+		fprintf(stderr, "\nUnable to Allocate Sweep Results...\n\n");
+		return PROGRAM_ERROR;
+	}
+
+	for (thread_index = 0; thread_index < number_threads; thread_index++) {
+		sweep_threads[thread_index] = CreateThread(NULL, 0, sweepConfigs, &sweep_results[thread_index], 0, NULL);
+		if (sweep_threads[thread_index] == NULL) {
+			fprintf(stderr, "\nUnable to Start Sweep Thread...\n\n");
+			return PROGRAM_ERROR;
+		}
+	}
+
+	WaitForMultipleObjects(number_threads, sweep_threads, TRUE, INFINITE);
+
+	for (thread_index = 0; thread_index < number_threads; thread_index++) {
+		reference_ticks += sweep_results[thread_index].reference_ticks;
+		frames_compared += sweep_results[thread_index].frames_compared;
+		CloseHandle(sweep_threads[thread_index]);
+	}
+
+	fprintf(stdout, "\nSwept %d Configurations on %u Threads (%lu Reference Frames).\n\n",
+		SWEEP_CONFIGS, (unsigned)number_threads, frames_compared);
+
+	/* Speedup is the Reference Time Over the Candidate Time for the Whole Sweep. */
+	for (candidate_index = 0; candidate_index < candidate_count; candidate_index++) {
+		candidate_ticks = FALSE;
+		mismatches = FALSE;
+
+		for (thread_index = 0; thread_index < number_threads; thread_index++) {
+			candidate_ticks += sweep_results[thread_index].candidate_ticks[candidate_index];
+			mismatches += sweep_results[thread_index].mismatches[candidate_index];
+		}
+
+		fprintf(stdout, "%-16s Mismatches = %lu, Speedup = %.2fx\n", candidate_engines[candidate_index].engine_name,
+			mismatches, (candidate_ticks > FALSE) ? (double)reference_ticks / (double)candidate_ticks : 0.0);
+
+		total_mismatches += mismatches;
+	}
+
+	free(sweep_results);
+
+	return (total_mismatches == FALSE) ? FALSE : PROGRAM_ERROR;
+}
+
+/*
+ * Sweeps Configurations Until None Remain. Each Configuration Runs the Reference
+ * Once and Compares Every Candidate Against its Frames.
+ *
+ * PARAM: sweep_result is a pointer to the SWEEP_RESULT owned by this thread.
+ * PRE: sweep_result is zeroed and not shared with any other thread.
+ * POST: sweep_result holds the time taken and mismatches found by this thread.
+ * RETURN: 0
+ */
+DWORD WINAPI sweepConfigs(LPVOID sweep_result) {
+	/* Local Variables */
+
+	SWEEP_RESULT* result = (SWEEP_RESULT*)sweep_result;
+
+	FRAME_STREAM* reference = malloc(sizeof(FRAME_STREAM));
+	FRAME_STREAM* candidate = malloc(sizeof(FRAME_STREAM));
+
+	LONGLONG start_ticks = FALSE;
+	LONG config_index = FALSE;
+
+	uint8_t message_length = FALSE;
+	uint8_t number_scrolls = FALSE;
+	uint8_t candidate_index = FALSE;
+
+	if (reference == NULL || candidate == NULL) {
+		free(reference);
+		free(candidate);
+		result->mismatches[0]++;
+		return FALSE;
+	}
+
+	while ((config_index = InterlockedIncrement(&next_config)) < SWEEP_CONFIGS) {
+		message_length = (uint8_t)(config_index / (VALUE_COUNTER_MAX + 1)) + 1;
+		number_scrolls = (uint8_t)(config_index % (VALUE_COUNTER_MAX + 1));
+
+		start_ticks = readTicks();
+		referenceStream(sweep_message, message_length, number_scrolls, reference);
+		result->reference_ticks += readTicks() - start_ticks;
+
+		result->frames_compared += reference->frame_count;
+
+		for (candidate_index = 0; candidate_index < candidate_count; candidate_index++) {
+			start_ticks = readTicks();
+			candidate_engines[candidate_index].renderStream(sweep_message, message_length, number_scrolls, candidate);
+			result->candidate_ticks[candidate_index] += readTicks() - start_ticks;
+
+			if (compareStreams(reference, candidate, candidate_engines[candidate_index].engine_name,
+				message_length, number_scrolls) == FALSE) result->mismatches[candidate_index]++;
+		}
+	}
+
+	free(reference);
+	free(candidate);
+
+	return FALSE;
+}
+
+/*
+ * Compares a Candidate Frame Stream Against the Reference and Reports the First Difference.
+ *
+ * PARAM: reference and candidate are pointers to FRAME_STREAMs for the same configuration;
+ *		  engine_name is a pointer to a char array naming the candidate;
+ *		  message_length and number_scrolls are uint8_ts describing the configuration.
+ * PRE: NULL (no pre-conditions)
+ * POST: first mismatching frame printed to stdout.
+ * RETURN: TRUE if both streams hold the same frames; otherwise FALSE.
+ */
+uint8_t compareStreams(const FRAME_STREAM* reference, const FRAME_STREAM* candidate,
+	const char* engine_name, uint8_t message_length, uint8_t number_scrolls) {
+	uint16_t frame_index = FALSE;
+
+	if (reference->overflowed == TRUE || candidate->overflowed == TRUE || reference->frame_count != candidate->frame_count) {
+		fprintf(stdout, "%s : Length = %u, Iterations = %u : %u Frames Instead of %u\n", engine_name,
+			(unsigned)message_length, (unsigned)number_scrolls, (unsigned)candidate->frame_count, (unsigned)reference->frame_count);
+		return FALSE;
+	}
+
+	for (frame_index = 0; frame_index < reference->frame_count; frame_index++) {
+		if (memcmp(reference->frames[frame_index], candidate->frames[frame_index], NUMBER_DISPLAYS) != FALSE) {
+			fprintf(stdout, "%s : Length = %u, Iterations = %u : Frame %u Differs\n", engine_name,
+				(unsigned)message_length, (unsigned)number_scrolls, (unsigned)frame_index);
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+/*
+ * Captures the Frames Written by scrollDisplay Through the Mock DAQ Module.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations;
+ * 		  stream is a pointer to the FRAME_STREAM receiving the frames.
+ * PRE: NULL (no pre-conditions)
+ * POST: stream holds the displays at each frame boundary, ending with all displays on.
+ * RETURN: VOID
+ */
+void referenceStream(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, FRAME_STREAM* stream) {
+	clearMock();
+	stream->frame_count = FALSE;
+	stream->overflowed = FALSE;
+
+	mock_stream = stream;
+	mockHooks(&reference_hooks);
+
+	runMock(runReference, message, message_length, number_scrolls);
+
+	mockHooks(NULL);
+	mock_stream = NULL;
+}
+
+/*
+ * Runs scrollDisplay as a Mock Engine.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations.
+ * PRE: called by runMock.
+ * POST: digital displays are all turned on.
+ * RETURN: VOID
+ */
+void runReference(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls) {
+	scrollDisplay(message, message_length, (int8_t)number_scrolls);
+}
+
+/*
+ * Candidate Engine Computing Every Frame Directly From its Index.
+ *
+ * PARAM: message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations;
+ * 		  stream is a pointer to the FRAME_STREAM receiving the frames.
+ * PRE: NULL (no pre-conditions)
+ * POST: stream holds every frame of the scrolling display program.
+ * RETURN: VOID
+ */
+void computeStream(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls, FRAME_STREAM* stream) {
+	uint16_t total_frames = countFrames(message_length, number_scrolls);
+	uint16_t frame_index = FALSE;
+
+	stream->overflowed = (total_frames > MAX_FRAMES);
+	stream->frame_count = stream->overflowed ? MAX_FRAMES : total_frames;
+
+	for (frame_index = 0; frame_index < stream->frame_count; frame_index++)
+		computeFrame(message, message_length, number_scrolls, frame_index, stream->frames[frame_index]);
+}
+
+/*
+ * Appends the Mock Digital Displays to the Stream Being Captured.
+ *
+ * PARAM: VOID
+ * PRE: a reference stream is being captured on this thread.
+ * POST: current displays are the next frame of the stream.
+ * RETURN: VOID
+ */
+void captureFrame(void) {
+	if (mock_stream == NULL) return;
+
+	if (mock_stream->frame_count >= MAX_FRAMES) {
+		mock_stream->overflowed = TRUE;
+		return;
+	}
+
+	memcpy(mock_stream->frames[mock_stream->frame_count++], mockDisplays(), NUMBER_DISPLAYS);
+}
+
+/*
+ * Reads the High Resolution Performance Counter.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: current performance counter ticks.
+ */
+LONGLONG readTicks(void) {
+	LARGE_INTEGER current_ticks;
+
+	QueryPerformanceCounter(&current_ticks);
+	return current_ticks.QuadPart;
+}
+
+/***************************************************************/
+/* Mock Switches Module: Frame Boundaries Are the Frame Waits. */
+/***************************************************************/
+
+void configSwitches(void) {
+	return;
+}
+
+uint8_t resetDAQ(void) {
+	return FALSE;
+}
+
+uint16_t waitFrame(unsigned long frame_length) {
+	captureFrame();
+	return 1;
+}
@@ -0,0 +1,68 @@
+/*
+ * File: mock.h
+ * Purpose: Contains Precompiler Directives, Structures
+ *          and Function Prototypes for the Mock DAQ Module Shared by
+ *          the Differential Harness and the Checks.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef MOCK_H
+#define MOCK_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <setjmp.h>
+#include <string.h>
+
+#include <stdint.h>
+
+#include "scroll.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+/* Each Thread Runs the Mock DAQ Module on its Own Displays and Clock. */
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+/**************/
+/* Structures */
+/**************/
+
+/* Engine Runs a Scrolling Display Program Until it Calls finishDisplay. */
+typedef void (*MOCK_ENGINE)(const uint8_t* message, uint8_t message_length, uint8_t number_scrolls);
+
+/* Callbacks Made by the Mock DAQ Module; Any of Them May Be NULL. */
+typedef struct {
+	/* Simulated Clock Has Advanced. */
+	void (*clockAdvanced)(void);
+
+	/* data is About to Be Written to position; Displays Still Hold the Previous Data. */
+	void (*displayWritten)(uint8_t data, uint8_t position);
+
+	/* Engine Has Turned On the Displays and is About to Finish. */
+	void (*displayFinished)(void);
+} MOCK_HOOKS;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+void clearMock(void);
+void mockHooks(const MOCK_HOOKS* hooks);
+void mockCosts(unsigned long write_micros, unsigned long read_micros);
+void mockSwitch(uint8_t channel, uint8_t value);
+void runMock(MOCK_ENGINE engine, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls);
+
+const uint8_t* mockDisplays(void);
+unsigned long mockMicros(void);
+void advanceClock(unsigned long micros);
+
+#endif
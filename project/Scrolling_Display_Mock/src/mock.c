@@ -0,0 +1,186 @@
+/*
+ * File : mock.c
+ * Purpose:	To Stand In for the DAQ Module so Scrolling Display Engines Run Without Hardware.
+ * 		Input: Switch Values and Call Costs Set by the Harness or the Checks.
+ *		Output:	Mock Digital Displays on a Simulated Clock.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "mock.h"
+
+/* Static Variables */
+
+/* Simulated Clock in Microseconds; Only Mock DAQ Calls Advance It. */
+static THREAD_LOCAL unsigned long mock_micros;
+
+static THREAD_LOCAL unsigned long write_cost;
+static THREAD_LOCAL unsigned long read_cost;
+
+static THREAD_LOCAL uint8_t mock_displays[NUMBER_DISPLAYS];
+static THREAD_LOCAL uint8_t mock_switches[2];
+
+static THREAD_LOCAL const MOCK_HOOKS* mock_hooks;
+static THREAD_LOCAL jmp_buf* mock_finish;
+
+/*
+ * Turns Off the Mock Digital Displays and Sets the Switches to Run With No Reset.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: displays are all DISPLAY_OFF; switches are in run with no reset.
+ * RETURN: VOID
+ */
+void clearMock(void) {
+	memset(mock_displays, DISPLAY_OFF, NUMBER_DISPLAYS);
+
+	mock_switches[RESET_CHANNEL] = FALSE;
+	mock_switches[RUN_CHANNEL] = TRUE;
+}
+
+/*
+ * Sets the Callbacks Made by the Mock DAQ Module on This Thread.
+ *
+ * PARAM: hooks is a pointer to a MOCK_HOOKS which outlives its use; NULL for no callbacks.
+ * PRE: NULL (no pre-conditions)
+ * POST: every later mock DAQ call makes the callbacks in hooks.
+ * RETURN: VOID
+ */
+void mockHooks(const MOCK_HOOKS* hooks) {
+	mock_hooks = hooks;
+}
+
+/*
+ * Sets the Simulated Time Taken by Mock DAQ Calls. Calls Cost Nothing Until This is Called.
+ *
+ * PARAM: write_micros and read_micros are unsigned longs representing the cost
+ *		  of displayWrite and digitalRead in microseconds.
+ * PRE: NULL (no pre-conditions)
+ * POST: every later mock DAQ call advances the simulated clock by its cost.
+ * RETURN: VOID
+ */
+void mockCosts(unsigned long write_micros, unsigned long read_micros) {
+	write_cost = write_micros;
+	read_cost = read_micros;
+}
+
+/*
+ * Sets the Value Read From a Switch Channel.
+ *
+ * PARAM: channel is a uint8_t which is RESET_CHANNEL or RUN_CHANNEL;
+ *		  value is a uint8_t which is TRUE or FALSE.
+ * PRE: NULL (no pre-conditions)
+ * POST: digitalRead(channel) returns value.
+ * RETURN: VOID
+ */
+void mockSwitch(uint8_t channel, uint8_t value) {
+	if (channel == RESET_CHANNEL || channel == RUN_CHANNEL) mock_switches[channel] = value;
+}
+
+/*
+ * Runs an Engine Through the Mock DAQ Module Until it Calls finishDisplay.
+ *
+ * PARAM: engine is a MOCK_ENGINE which runs a scrolling display program;
+ *		  message is a uint8_t pointer to an array of bytes to write to the digital displays;
+ * 		  message_length is a uint8_t which represents the number of bytes in the message;
+ * 		  number_scrolls is a uint8_t which represents the number of iterations.
+ * PRE: NULL (no pre-conditions)
+ * POST: digital displays are all turned on.
+ * RETURN: VOID
+ */
+void runMock(MOCK_ENGINE engine, const uint8_t* message, uint8_t message_length, uint8_t number_scrolls) {
+	jmp_buf finish_point;
+
+	mock_finish = &finish_point;
+
+	/* finishDisplay Returns Here Once the Displays Are All Turned On. */
+	if (setjmp(finish_point) == FALSE) engine(message, message_length, number_scrolls);
+
+	mock_finish = NULL;
+}
+
+/*
+ * Reads the Mock Digital Displays.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: pointer to the NUMBER_DISPLAYS bytes last written to each position.
+ */
+const uint8_t* mockDisplays(void) {
+	return mock_displays;
+}
+
+/*
+ * Reads the Simulated Clock.
+ *
+ * PARAM: VOID
+ * PRE: NULL (no pre-conditions)
+ * POST: NULL (no side-effects)
+ * RETURN: microseconds elapsed on the simulated clock.
+ */
+unsigned long mockMicros(void) {
+	return mock_micros;
+}
+
+/*
+ * Advances the Simulated Clock.
+ *
+ * PARAM: micros is an unsigned long representing the time to advance in microseconds.
+ * PRE: NULL (no pre-conditions)
+ * POST: clockAdvanced hook is called.
+ * RETURN: VOID
+ */
+void advanceClock(unsigned long micros) {
+	mock_micros += micros;
+
+	if (mock_hooks != NULL && mock_hooks->clockAdvanced != NULL) mock_hooks->clockAdvanced();
+}
+
+/******************************************************/
+/* Mock DAQ Module: Every Call Costs Simulated Time. */
+/******************************************************/
+
+int setupDAQ(int setupNum) {
+	return TRUE;
+}
+
+int digitalRead(int channel) {
+	advanceClock(read_cost);
+	return (channel == RESET_CHANNEL || channel == RUN_CHANNEL) ? mock_switches[channel] : FALSE;
+}
+
+double analogRead(int channel) {
+	return 0.0;
+}
+
+void digitalWrite(int channel, int val) {
+	return;
+}
+
+void displayWrite(int data, int position) {
+	advanceClock(write_cost);
+	if (position < VALUE_MIN || position >= NUMBER_DISPLAYS) return;
+
+	if (mock_hooks != NULL && mock_hooks->displayWritten != NULL) mock_hooks->displayWritten((uint8_t)data, (uint8_t)position);
+	mock_displays[position] = (uint8_t)data;
+}
+
+int continueSuperLoop(void) {
+	return TRUE;
+}
+
+void delay(unsigned long ms) {
+	advanceClock(ms * 1000);
+}
+
+unsigned long millis(void) {
+	return mock_micros / 1000;
+}
+
+void finishDisplay(void) {
+	if (mock_hooks != NULL && mock_hooks->displayFinished != NULL) mock_hooks->displayFinished();
+
+	/* Engines Run Outside runMock Return From finishDisplay. */
+	if (mock_finish != NULL) longjmp(*mock_finish, TRUE);
+}
@@ -0,0 +1,102 @@
+/*
+ * File: preview.h
+ * Purpose: Contains Precompiler Directives, Enumerations
+ *          and Function Prototypes for Rasterizing Scrolling Display
+ *          Frames to Image Files Without the DAQ Simulator.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#ifndef PREVIEW_H
+#define PREVIEW_H
+
+/*******************/
+/* Include Headers */
+/******************/
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <Windows.h>
+
+#include "scroll.h"
+
+/**************************/
+/* Precompiler Directives */
+/*************************/
+
+#define PROGRAM_ERROR -1
+
+#define BUFFSIZE 512
+
+/* Bits of the DISPLAY_* Encodings, Most Significant Bit First. */
+#define SEGMENT_A 0b10000000
+#define SEGMENT_B 0b01000000
+#define SEGMENT_C 0b00100000
+#define SEGMENT_D 0b00010000
+#define SEGMENT_E 0b00001000
+#define SEGMENT_F 0b00000100
+#define SEGMENT_G 0b00000010
+#define SEGMENT_DP 0b00000001
+
+/****************/
+/* Enumerations */
+/****************/
+
+/* Geometry of a Single Digital Display in Pixels. */
+typedef enum {
+	CELL_WIDTH = 48,
+	CELL_HEIGHT = 80,
+	CELL_MARGIN = 6,
+	SEGMENT_THICKNESS = 6,
+
+	IMAGE_WIDTH = NUMBER_DISPLAYS * CELL_WIDTH,
+	IMAGE_HEIGHT = CELL_HEIGHT,
+	PIXEL_BYTES = 3
+} PREVIEW_SIZES;
+
+typedef enum {
+	SEGMENT_COUNT = 8,
+	MAX_THREADS = 64
+} PREVIEW_LIMITS;
+
+/**************/
+/* Structures */
+/**************/
+
+/* Rectangle Covered by a Segment Within a Digital Display, From (left, top) to (right, bottom). */
+typedef struct {
+	uint8_t segment_mask;
+	uint8_t left, top, right, bottom;
+} SEGMENT_RECT;
+
+/* Work Assigned to a Rendering Thread. */
+typedef struct {
+	const uint8_t* message;
+	uint8_t message_length;
+	uint8_t number_scrolls;
+
+	uint16_t first_frame;
+	uint16_t frame_stride;
+	uint16_t total_frames;
+
+	const char* output_prefix;
+	uint16_t frames_failed;
+} RENDER_JOB;
+
+/***********************/
+/* Function Prototypes */
+/***********************/
+
+DWORD WINAPI renderFrames(LPVOID render_job);
+
+void rasterizeFrame(const uint8_t* frame, uint8_t* pixels);
+void fillRect(uint8_t* pixels, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, const uint8_t* color);
+
+uint8_t writeImage(const char* image_path, const uint8_t* pixels);
+
+void handleError(char* message);
+
+#endif
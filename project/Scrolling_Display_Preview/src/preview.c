@@ -0,0 +1,262 @@
+/*
+ * File : preview.c
+ * Purpose:	To Rasterize Every Frame of the Scrolling Display to Image Files Without the DAQ Simulator.
+ * 		Input: Number of Scrolling Display Iterations, Output Prefix and Optional Message Bytes.
+ *		Output:	One Binary PPM Image per Frame, Rendered in Parallel Across All Processors.
+ * Author: Muntakim Rahman
+ * Date: 2021-10-06
+ */
+
+#include "preview.h"
+
+/* Static Variables */
+
+/* Segment Layout Follows the Bit Order of the DISPLAY_* Encodings. */
+static const SEGMENT_RECT segment_rects[SEGMENT_COUNT] = {
+	{ SEGMENT_A, CELL_MARGIN + SEGMENT_THICKNESS, CELL_MARGIN,
+		CELL_WIDTH - CELL_MARGIN - SEGMENT_THICKNESS, CELL_MARGIN + SEGMENT_THICKNESS },
+	{ SEGMENT_B, CELL_WIDTH - CELL_MARGIN - SEGMENT_THICKNESS, CELL_MARGIN + SEGMENT_THICKNESS,
+		CELL_WIDTH - CELL_MARGIN, (CELL_HEIGHT - SEGMENT_THICKNESS) / 2 },
+	{ SEGMENT_C, CELL_WIDTH - CELL_MARGIN - SEGMENT_THICKNESS, (CELL_HEIGHT + SEGMENT_THICKNESS) / 2,
+		CELL_WIDTH - CELL_MARGIN, CELL_HEIGHT - CELL_MARGIN - SEGMENT_THICKNESS },
+	{ SEGMENT_D, CELL_MARGIN + SEGMENT_THICKNESS, CELL_HEIGHT - CELL_MARGIN - SEGMENT_THICKNESS,
+		CELL_WIDTH - CELL_MARGIN - SEGMENT_THICKNESS, CELL_HEIGHT - CELL_MARGIN },
+	{ SEGMENT_E, CELL_MARGIN, (CELL_HEIGHT + SEGMENT_THICKNESS) / 2,
+		CELL_MARGIN + SEGMENT_THICKNESS, CELL_HEIGHT - CELL_MARGIN - SEGMENT_THICKNESS },
+	{ SEGMENT_F, CELL_MARGIN, CELL_MARGIN + SEGMENT_THICKNESS,
+		CELL_MARGIN + SEGMENT_THICKNESS, (CELL_HEIGHT - SEGMENT_THICKNESS) / 2 },
+	{ SEGMENT_G, CELL_MARGIN + SEGMENT_THICKNESS, (CELL_HEIGHT - SEGMENT_THICKNESS) / 2,
+		CELL_WIDTH - CELL_MARGIN - SEGMENT_THICKNESS, (CELL_HEIGHT + SEGMENT_THICKNESS) / 2 },
+	{ SEGMENT_DP, CELL_WIDTH - CELL_MARGIN + 1, CELL_HEIGHT - CELL_MARGIN - SEGMENT_THICKNESS,
+		CELL_WIDTH - 1, CELL_HEIGHT - CELL_MARGIN }
+};
+
+static const uint8_t segment_on[PIXEL_BYTES] = { 255, 40, 24 };
+static const uint8_t segment_off[PIXEL_BYTES] = { 40, 12, 8 };
+static const uint8_t background[PIXEL_BYTES] = { 0, 0, 0 };
+
+static uint8_t custom_message[NUMBER_DISPLAYS];
+
+/*
+ * Main Function Drives the Program. Every Frame of the Scrolling Display
+ * is Computed From its Index, so Frames Are Split Evenly Across Threads.
+ * Usage: Scrolling_Display_Preview <iterations> <output_prefix> [message bytes in hex ...]
+ * PRE: NULL (no pre-conditions)
+ * POST: <output_prefix>_NNNN.ppm is written for every frame.
+ * RETURN: 0 if all frames were written; otherwise PROGRAM_ERROR.
+ */
+int main(int argc, char* argv[]) {
+	/* Local Variables */
+
+	const uint8_t* message = phrase_message;
+	uint8_t message_length = PHRASE_LENGTH;
+
+	long number_scrolls = FALSE;
+	unsigned long message_byte = FALSE;
+	char* parse_end = NULL;
+
+	RENDER_JOB render_jobs[MAX_THREADS];
+	HANDLE render_threads[MAX_THREADS];
+	SYSTEM_INFO system_info;
+
+	uint16_t total_frames = FALSE;
+	uint16_t frames_failed = FALSE;
+	uint16_t number_threads = FALSE;
+	uint16_t thread_index = FALSE;
+
+	int arg_index = FALSE;
+
+	if (argc < 3) handleError("Usage: Scrolling_Display_Preview <iterations> <output_prefix> [message bytes in hex ...]\n");
+
+	/* Number of Iterations */
+	/* Arguments Without Digits, With Trailing Characters or Out of Range Are Rejected. */
+	errno = FALSE;
+	number_scrolls = strtol(argv[1], &parse_end, 10);
+	if (parse_end == argv[1] || *parse_end != '\0' || errno == ERANGE || number_scrolls < VALUE_MIN || number_scrolls > VALUE_COUNTER_MAX)
+		handleError("\nInvalid Scrolling Configuration...\n\n");
+
+	/* Message Bytes Use the Same Encoding as the DISPLAY_* Definitions. */
+	if (argc > 3) {
+		if (argc - 3 > NUMBER_DISPLAYS) handleError("\nMessage Does Not Fit on the Digital Displays...\n\n");
+
+		for (arg_index = 3; arg_index < argc; arg_index++) {
+			errno = FALSE;
+			message_byte = strtoul(argv[arg_index], &parse_end, 16);
+			if (parse_end == argv[arg_index] || *parse_end != '\0' || errno == ERANGE || message_byte > DISPLAY_ON) handleError("\nInvalid Message Byte...\n\n");
+
+			custom_message[arg_index - 3] = (uint8_t)message_byte;
+		}
+
+		message = custom_message;
+		message_length = (uint8_t)(argc - 3);
+	}
+
+	total_frames = countFrames(message_length, (uint8_t)number_scrolls);
+
+	GetSystemInfo(&system_info);
+	number_threads = (uint16_t)system_info.dwNumberOfProcessors;
+	if (number_threads > MAX_THREADS) number_threads = MAX_THREADS;
+	if (number_threads > total_frames) number_threads = total_frames;
+	if (number_threads == FALSE) number_threads = 1;
+
+	/* Each Thread Renders Every number_threads-th Frame. */
+	for (thread_index = 0; thread_index < number_threads; thread_index++) {
+		render_jobs[thread_index].message = message;
+		render_jobs[thread_index].message_length = message_length;
+		render_jobs[thread_index].number_scrolls = (uint8_t)number_scrolls;
+
+		render_jobs[thread_index].first_frame = thread_index;
+		render_jobs[thread_index].frame_stride = number_threads;
+		render_jobs[thread_index].total_frames = total_frames;
+
+		render_jobs[thread_index].output_prefix = argv[2];
+		render_jobs[thread_index].frames_failed = FALSE;
+
+		render_threads[thread_index] = CreateThread(NULL, 0, renderFrames, &render_jobs[thread_index], 0, NULL);
+		if (render_threads[thread_index] == NULL) handleError("\nUnable to Start Rendering Thread...\n\n");
+	}
+
+	WaitForMultipleObjects(number_threads, render_threads, TRUE, INFINITE);
+
+	for (thread_index = 0; thread_index < number_threads; thread_index++) {
+		frames_failed += render_jobs[thread_index].frames_failed;
+		CloseHandle(render_threads[thread_index]);
+	}
+
+	fprintf(stdout, "Rendered %u Frames on %u Threads (%u Failed).\n",
+		(unsigned)(total_frames - frames_failed), (unsigned)number_threads, (unsigned)frames_failed);
+
+	return (frames_failed == FALSE) ? FALSE : PROGRAM_ERROR;
+}
+
+/*
+ * Rasterizes and Writes the Frames Assigned to a Rendering Thread.
+ *
+ * PARAM: render_job is a pointer to the RENDER_JOB assigned to this thread.
+ * PRE: render_job is not shared with any other thread.
+ * POST: frames first_frame, first_frame + frame_stride, ... are written to image files;
+ *		 frames_failed counts the images which could not be written.
+ * RETURN: 0
+ */
+DWORD WINAPI renderFrames(LPVOID render_job) {
+	/* Local Variables */
+
+	RENDER_JOB* job = (RENDER_JOB*)render_job;
+
+	uint8_t frame[NUMBER_DISPLAYS];
+	uint8_t* pixels = malloc(IMAGE_WIDTH * IMAGE_HEIGHT * PIXEL_BYTES);
+	char image_path[BUFFSIZE];
+
+	uint16_t frame_index = FALSE;
+
+	if (pixels == NULL) {
+		job->frames_failed = (job->total_frames - job->first_frame + job->frame_stride - 1) / job->frame_stride;
+		return FALSE;
+	}
+
+	for (frame_index = job->first_frame; frame_index < job->total_frames; frame_index += job->frame_stride) {
+		computeFrame(job->message, job->message_length, job->number_scrolls, frame_index, frame);
+		rasterizeFrame(frame, pixels);
+
+		sprintf_s(image_path, BUFFSIZE, "%s_%04u.ppm", job->output_prefix, (unsigned)frame_index);
+		if (writeImage(image_path, pixels) == FALSE) job->frames_failed++;
+	}
+
+	free(pixels);
+	return FALSE;
+}
+
+/*
+ * Rasterizes the Digital Displays of a Frame. Display Position 0 is the Rightmost Display.
+ *
+ * PARAM: frame is a uint8_t pointer to an array of NUMBER_DISPLAYS bytes;
+ *		  pixels is a uint8_t pointer to an IMAGE_WIDTH x IMAGE_HEIGHT RGB image.
+ * PRE: NULL (no pre-conditions)
+ * POST: every segment of every display is drawn lit or unlit according to frame.
+ * RETURN: VOID
+ */
+void rasterizeFrame(const uint8_t* frame, uint8_t* pixels) {
+	/* Local Variables */
+
+	uint8_t display_position = FALSE;
+	uint8_t segment_index = FALSE;
+
+	uint16_t cell_left = FALSE;
+	const SEGMENT_RECT* segment = NULL;
+
+	fillRect(pixels, 0, 0, IMAGE_WIDTH, IMAGE_HEIGHT, background);
+
+	for (display_position = 0; display_position < NUMBER_DISPLAYS; display_position++) {
+		cell_left = ((NUMBER_DISPLAYS - 1) - display_position) * CELL_WIDTH;
+
+		for (segment_index = 0; segment_index < SEGMENT_COUNT; segment_index++) {
+			segment = &segment_rects[segment_index];
+
+			fillRect(pixels, cell_left + segment->left, segment->top, cell_left + segment->right, segment->bottom,
+				(frame[display_position] & segment->segment_mask) ? segment_on : segment_off);
+		}
+	}
+}
+
+/*
+ * Fills a Rectangle of the Image With a Single Color.
+ *
+ * PARAM: pixels is a uint8_t pointer to an IMAGE_WIDTH x IMAGE_HEIGHT RGB image;
+ *		  left, top, right and bottom are uint16_ts bounding the rectangle, right and bottom exclusive;
+ *		  color is a uint8_t pointer to PIXEL_BYTES color components.
+ * PRE: right <= IMAGE_WIDTH, bottom <= IMAGE_HEIGHT.
+ * POST: pixels in the rectangle are set to color.
+ * RETURN: VOID
+ */
+void fillRect(uint8_t* pixels, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, const uint8_t* color) {
+	uint16_t row = FALSE;
+	uint16_t column = FALSE;
+	uint8_t* pixel = NULL;
+
+	for (row = top; row < bottom; row++) {
+		pixel = pixels + ((row * IMAGE_WIDTH) + left) * PIXEL_BYTES;
+
+		for (column = left; column < right; column++) {
+			*pixel++ = color[0];
+			*pixel++ = color[1];
+			*pixel++ = color[2];
+		}
+	}
+}
+
+/*
+ * Writes an Image to a Binary PPM File.
+ *
+ * PARAM: image_path is a pointer to a char array naming the output file;
+ *		  pixels is a uint8_t pointer to an IMAGE_WIDTH x IMAGE_HEIGHT RGB image.
+ * PRE: NULL (no pre-conditions)
+ * POST: image file is created or overwritten.
+ * RETURN: TRUE if the image was written; otherwise FALSE.
+ */
+uint8_t writeImage(const char* image_path, const uint8_t* pixels) {
+	FILE* image_file = NULL;
+	size_t image_bytes = IMAGE_WIDTH * IMAGE_HEIGHT * PIXEL_BYTES;
+	uint8_t image_written = FALSE;
+
+	if (fopen_s(&image_file, image_path, "wb") != FALSE || image_file == NULL) return FALSE;
+
+	fprintf(image_file, "P6\n%d %d\n255\n", IMAGE_WIDTH, IMAGE_HEIGHT);
+	image_written = (fwrite(pixels, sizeof(uint8_t), image_bytes, image_file) == image_bytes);
+
+	if (fclose(image_file) != FALSE) image_written = FALSE;
+
+	return image_written;
+}
+
+/*
+ * Print Error Message to Standard Error and Exit Program.
+ * PARAM: message is a pointer to a char array to print to screen.
+ * PRE: error in preview program configuration.
+ * POST: error message printed to stderr.
+ * RETURN: VOID
+ */
+void handleError(char* message) {
+	fprintf(stderr, "%s", message);
+
+	exit(PROGRAM_ERROR);
+}